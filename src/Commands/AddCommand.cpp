@@ -6,6 +6,8 @@
  */
 
 #include "AddCommand.h"
+#include "RemoveCommand.h"
+#include "EventBus.h"
 #include "utils/EnumUtils.h"
 #include "utils/GstUtils.h"
 #include <set>
@@ -35,6 +37,50 @@ void AddCommand::run_command(std::vector<CommandListener*> listeners)
 	run_command_ret(listeners);
 }
 
+static const char* signals_connected_key = "gst-creator-signals-connected";
+
+// signals are connected once per object, even if the object is added again by undo/redo
+static bool mark_signals_connected(const RefPtr<Object>& object)
+{
+	if (g_object_get_data(G_OBJECT(object->gobj()), signals_connected_key))
+		return false;
+
+	g_object_set_data(G_OBJECT(object->gobj()), signals_connected_key, GINT_TO_POINTER(1));
+	return true;
+}
+
+// signals may be emitted by streaming threads, so listeners are notified through the event bus
+static void connect_pad_signals(const RefPtr<Pad>& pad, const EventBus::listener_list& listeners)
+{
+	if (!mark_signals_connected(pad))
+		return;
+
+	pad->signal_linked().connect([listeners](const Glib::RefPtr<Gst::Pad>& pad) {
+		EventBus::get().post(EventBus::EventType::PAD_LINKED, pad, listeners);
+	});
+	pad->signal_unlinked().connect([listeners](const Glib::RefPtr<Gst::Pad>& pad) {
+		EventBus::get().post(EventBus::EventType::PAD_UNLINKED, pad, listeners);
+	});
+}
+
+static void connect_element_signals(const RefPtr<Element>& element, const EventBus::listener_list& listeners)
+{
+	if (!mark_signals_connected(element))
+		return;
+
+	element->signal_pad_added().connect([listeners](const Glib::RefPtr<Gst::Pad>& pad) {
+		connect_pad_signals(pad, listeners);
+		EventBus::get().post(EventBus::EventType::PAD_ADDED, pad, listeners);
+	});
+	element->signal_pad_removed().connect([listeners](const Glib::RefPtr<Gst::Pad>& pad) {
+		EventBus::get().post(EventBus::EventType::PAD_REMOVED, pad, listeners);
+	});
+
+	auto iterator = element->iterate_pads();
+	while (iterator.next())
+		connect_pad_signals(*iterator, listeners);
+}
+
 RefPtr<Object> AddCommand::run_command_ret(std::vector<CommandListener*> listeners)
 {
 	if (type == ObjectType::PAD)
@@ -43,16 +89,7 @@ RefPtr<Object> AddCommand::run_command_ret(std::vector<CommandListener*> listene
 		if (GST_IS_PAD(object->gobj()))
 		{
 			pad = pad.cast_static(object);
-			pad->signal_linked().connect([listeners](const Glib::RefPtr<Gst::Pad>& pad) {
-				for (auto listener : listeners)
-					if (listener != nullptr && CommandListener::get_refcount() > 0)
-						listener->pad_linked(pad);
-			});
-			pad->signal_unlinked().connect([listeners](const Glib::RefPtr<Gst::Pad>& pad) {
-				for (auto listener : listeners)
-					if (listener != nullptr && CommandListener::get_refcount() > 0)
-						listener->pad_unlinked(pad);
-			});
+			connect_pad_signals(pad, std::make_shared<const std::vector<CommandListener*>>(listeners));
 			parent->add_pad(pad);
 		}
 		else if (GST_IS_PAD_TEMPLATE(object->gobj()))
@@ -62,51 +99,18 @@ RefPtr<Object> AddCommand::run_command_ret(std::vector<CommandListener*> listene
 		else
 			throw runtime_error("cannot run command: object is not a pad");
 
+		added_object = pad;
 		return pad;
 	}
 	else
 	{
 		if (GST_IS_ELEMENT(object->gobj()) && GST_IS_BIN(parent->gobj()))
 		{
-			RefPtr<Pipeline> pipeline = pipeline.cast_static(parent);
+			RefPtr<Bin> bin = bin.cast_static(parent);
 			RefPtr<Element> element = element.cast_static(object);
-			pipeline->add(element);
-			element->signal_pad_added().connect([listeners](const Glib::RefPtr<Gst::Pad>& pad) {
-				for (auto listener : listeners)
-					if (listener != nullptr && CommandListener::get_refcount() > 0)
-						listener->pad_added(pad);
-
-				pad->signal_linked().connect([listeners](const Glib::RefPtr<Gst::Pad>& pad) {
-					for (auto listener : listeners)
-						if (listener != nullptr && CommandListener::get_refcount() > 0)
-							listener->pad_linked(pad);
-				});
-				pad->signal_unlinked().connect([&listeners](const Glib::RefPtr<Gst::Pad>& pad) {
-					for (auto listener : listeners)
-						if (listener != nullptr && CommandListener::get_refcount() > 0)
-							listener->pad_unlinked(pad);
-				});
-			});
-			element->signal_pad_removed().connect([listeners](const Glib::RefPtr<Gst::Pad>& pad) {
-				for (auto listener : listeners)
-					if (listener != nullptr && CommandListener::get_refcount() > 0)
-						listener->pad_removed(pad);
-			});
-
-			auto iterator = element->iterate_pads();
-			while (iterator.next())
-			{
-				iterator->signal_linked().connect([&iterator, listeners](const Glib::RefPtr<Gst::Pad>& sec_pad) {
-					for (auto listener : listeners)
-						if (listener != nullptr && CommandListener::get_refcount() > 0)
-							listener->pad_linked(sec_pad);
-				});
-				iterator->signal_unlinked().connect([&iterator, listeners](const Glib::RefPtr<Gst::Pad>& sec_pad) {
-					for (auto listener : listeners)
-						if (listener != nullptr && CommandListener::get_refcount() > 0)
-							listener->pad_unlinked(sec_pad);
-				});
-			}
+			bin->add(element);
+			connect_element_signals(element, std::make_shared<const std::vector<CommandListener*>>(listeners));
+			added_object = element;
 			return element;
 		}
 		else
@@ -114,6 +118,14 @@ RefPtr<Object> AddCommand::run_command_ret(std::vector<CommandListener*> listene
 	}
 }
 
+Command* AddCommand::get_inverse()
+{
+	if (!added_object)
+		return nullptr;
+
+	return new RemoveCommand(type, added_object);
+}
+
 AddCommand* AddCommand::from_args(const vector<string>& args, const RefPtr<Pipeline>& model)
 {
 	if (args.size() < 1)
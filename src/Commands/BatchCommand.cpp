@@ -0,0 +1,117 @@
+/*
+ * BatchCommand.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "BatchCommand.h"
+#include "CommandListener.h"
+
+using namespace std;
+
+BatchCommand::BatchCommand()
+: Command(CommandType::BATCH),
+  executed_count(0)
+{
+}
+
+BatchCommand::~BatchCommand()
+{
+}
+
+void BatchCommand::add_command(Command* command)
+{
+	entries.push_back({shared_ptr<Command>(command), command_builder()});
+}
+
+void BatchCommand::add_command(const command_builder& builder)
+{
+	entries.push_back({shared_ptr<Command>(), builder});
+}
+
+void BatchCommand::run_command(vector<CommandListener*> listeners)
+{
+	BulkUpdateScope bulk_update(listeners);
+
+	this->listeners = listeners;
+	executed_count = 0;
+
+	try
+	{
+		for (auto& entry : entries)
+		{
+			if (!entry.command && entry.builder)
+				entry.command.reset(entry.builder());
+
+			if (entry.command)
+				entry.command->run_command(listeners);
+
+			executed_count++;
+		}
+	}
+	catch (const exception& ex)
+	{
+		string rollback_error = rollback();
+
+		if (!rollback_error.empty())
+			throw runtime_error(string("batch command failed: ") + ex.what() +
+					"; reverting changes failed too: " + rollback_error);
+
+		throw runtime_error(string("batch command failed, changes have been reverted: ") + ex.what());
+	}
+}
+
+string BatchCommand::rollback()
+{
+	BulkUpdateScope bulk_update(listeners);
+	string errors;
+
+	// the remaining commands are still reverted, so the model is as close to the original as possible
+	while (executed_count > 0)
+	{
+		auto& entry = entries[--executed_count];
+
+		try
+		{
+			unique_ptr<Command> inverse(entry.command ? entry.command->get_inverse() : nullptr);
+			if (inverse)
+				inverse->run_command(listeners);
+		}
+		catch (const exception& ex)
+		{
+			errors += (errors.empty() ? "" : "; ") + string(ex.what());
+		}
+	}
+
+	// commands built lazily may refer to objects that don't exist anymore
+	for (auto& entry : entries)
+		if (entry.builder)
+			entry.command.reset();
+
+	return errors;
+}
+
+Command* BatchCommand::get_inverse()
+{
+	BatchCommand* inverse = new BatchCommand();
+
+	for (size_t i = executed_count; i > 0; i--)
+	{
+		shared_ptr<Command> command = entries[i - 1].command;
+		if (command)
+			inverse->add_command([command] { return command->get_inverse(); });
+	}
+
+	return inverse;
+}
+
+size_t BatchCommand::get_memory_size() const
+{
+	size_t size = sizeof(*this);
+
+	for (auto& entry : entries)
+		size += entry.command ? entry.command->get_memory_size() : sizeof(entry);
+
+	return size;
+}
@@ -6,88 +6,91 @@
  */
 
 #include "utils/EnumUtils.h"
+#include "utils/LinkMatrix.h"
 #include "CommandListener.h"
 #include "AddCommand.h"
-#include <set>
+#include "DisconnectCommand.h"
 
 using namespace Gst;
 using Glib::RefPtr;
 using namespace std;
 
 string ConnectCommand::future_keyword = "FUTURE";
-std::set<ConnectCommand::future_connection_pads> ConnectCommand::future_connection_pads_map;
-std::set<ConnectCommand::future_connection_elements> ConnectCommand::future_connection_elements_map;
 
-std::set<ConnectCommand::future_connection_elements> ConnectCommand::get_future_connections_element()
-{
-	return future_connection_elements_map;
-}
+static const char* future_handler_key = "gst-creator-future-handler";
 
-std::set<ConnectCommand::future_connection_pads> ConnectCommand::get_future_connections_pads()
+// the handler is connected once per element, even if future connections are added again
+static void connect_pad_added_handler(const RefPtr<Element>& element)
 {
-	return future_connection_pads_map;
+	if (g_object_get_data(G_OBJECT(element->gobj()), future_handler_key))
+		return;
+
+	g_object_set_data(G_OBJECT(element->gobj()), future_handler_key, GINT_TO_POINTER(1));
+	element->signal_pad_added().connect(sigc::ptr_fun(&ConnectCommand::element_pad_added));
 }
 
 void ConnectCommand::connect_future_elements(const RefPtr<Element>& src, const RefPtr<Element>& sink)
 {
-	future_connection_elements_map.insert(future_connection_elements(src, sink));
+	FutureConnectionTable::get(src).add(future_connection_elements(src, sink));
 }
 
 void ConnectCommand::connect_future_pads(const RefPtr<Element>& src_parent, const RefPtr<PadTemplate>& src_pad, const RefPtr<Pad>& sink_pad)
 {
-	future_connection_pads_map.insert(future_connection_pads(template_parent(src_parent, src_pad), sink_pad));
+	FutureConnectionTable::get(src_parent).add(future_connection_pads(template_parent(src_parent, src_pad), sink_pad));
 }
 
 void ConnectCommand::element_pad_added(const RefPtr<Pad>& pad)
 {
-	// TODO check template pad
+	auto parent = pad->get_parent_element();
+	auto tpl = pad->get_pad_template();
+
+	if (!parent)
+		return;
+
+	auto& table = FutureConnectionTable::get(parent);
 
 	// check, is pad->pad connection defined
-	auto tpl = pad->get_pad_template();
-	for (auto it = future_connection_pads_map.begin(); it != future_connection_pads_map.end(); ++it)
+	if (tpl)
 	{
-		if (it->first.second->get_parent() == tpl->get_parent() &&
-				it->first.second->get_name() == tpl->get_name() &&
-				pad->can_link(it->second))
+		for (auto sink : table.find_sink_pads(parent, tpl->get_name()))
 		{
-			pad->link(it->second);
-			return;
+			if (!sink->is_linked() && pad->can_link(sink))
+			{
+				pad->link(sink);
+				return;
+			}
 		}
 	}
 
 	// check, element->element connection defined
-	auto parent = pad->get_parent();
-	for (auto it = future_connection_elements_map.begin(); it != future_connection_elements_map.end(); ++it)
+	for (auto sink_element : table.find_sink_elements(parent))
 	{
-		if (it->first->get_parent() == parent->get_parent() && it->first->get_name() == it->first->get_name())
-		{
-			typedef Gst::Iterator<Gst::Pad> PadIter;
+		typedef Gst::Iterator<Gst::Pad> PadIter;
 
-			PadIter iter = it->second->iterate_pads();
-			while(iter.next())
+		PadIter iter = sink_element->iterate_pads();
+		while(iter.next())
+		{
+			if (pad->can_link(*iter))
 			{
-				if (pad->can_link(*iter))
-				{
-					pad->link(*iter);
-					return;
-				}
+				pad->link(*iter);
+				return;
 			}
+		}
 
-			auto tpls = it->second->get_factory()->get_static_pad_templates();
+		auto tpls = sink_element->get_factory()->get_static_pad_templates();
 
-			for(auto iter = tpls.begin();
-					iter != tpls.end(); ++iter )
-			{
-				if (iter->get()->get_presence() != PAD_REQUEST)
-					continue;
+		for(auto iter = tpls.begin();
+				iter != tpls.end(); ++iter )
+		{
+			if (iter->get()->get_presence() != PAD_REQUEST)
+				continue;
 
-				auto new_pad = Pad::create(iter->get());
-				pad->can_link(new_pad);
-				it->second->add_pad(new_pad);
-				pad->link(new_pad);
+			auto new_pad = Pad::create(iter->get());
+			pad->can_link(new_pad);
+			sink_element->add_pad(new_pad);
+			pad->link(new_pad);
 
-				return;
-			}
+			return;
 		}
 	}
 }
@@ -98,12 +101,9 @@ ConnectCommand::ConnectCommand(const RefPtr<Object>& src, const RefPtr<Object>&
   dst(dst),
   future(future)
 {
+	// future connections are registered when the command runs, so unused inverses don't modify the model
 	if (GST_IS_ELEMENT(src->gobj()) || GST_IS_ELEMENT(dst->gobj()))
-	{
 		type = ObjectType::ELEMENT;
-		if (future)
-			connect_future_elements(RefPtr<Element>::cast_static(src), RefPtr<Element>::cast_static(dst));
-	}
 	else if (GST_IS_PAD(src->gobj()) || GST_IS_PAD(dst->gobj()))
 	{
 		type = ObjectType::PAD;
@@ -122,25 +122,26 @@ ConnectCommand::ConnectCommand(const RefPtr<PadTemplate>& src, const RefPtr<Elem
   future(true)
 {
 	if (GST_IS_PAD(src->gobj()) || GST_IS_PAD(dst->gobj()))
-	{
 		type = ObjectType::PAD;
-		connect_future_pads(src_parent, RefPtr<PadTemplate>::cast_static(src), RefPtr<Pad>::cast_static(dst));
-	}
 	else
 		syntax_error("unknown object type");
 }
 
-void ConnectCommand::remove_future_connection(const RefPtr<PadTemplate>& tpl, const RefPtr<Pad>& pad, std::vector<CommandListener*> listeners)
+void ConnectCommand::remove_future_connection(const RefPtr<Element>& parent, const RefPtr<PadTemplate>& tpl,
+		const RefPtr<Pad>& pad, std::vector<CommandListener*> listeners)
 {
-	for (auto it = future_connection_pads_map.begin(); it != future_connection_pads_map.end(); ++it)
-	{
-		if (it->first.second == tpl && it->second == pad)
-		{
-			for (auto listener : listeners)
-				listener->future_connection_removed(*it);
-			future_connection_pads_map.erase(it);
-		}
-	}
+	future_connection_pads connection(template_parent(parent, tpl), pad);
+
+	if (!FutureConnectionTable::get(parent).remove(connection))
+		return;
+
+	for (auto listener : listeners)
+		listener->future_connection_removed(connection);
+}
+
+void ConnectCommand::remove_future_connection(const RefPtr<Element>& src, const RefPtr<Element>& sink)
+{
+	FutureConnectionTable::get(src).remove(future_connection_elements(src, sink));
 }
 
 ConnectCommand* ConnectCommand::from_linkage(const Linkage& lnk, std::vector<CommandListener*> listeners)
@@ -209,7 +210,10 @@ void ConnectCommand::run_command(std::vector<CommandListener*> listeners)
 				e_dst = e_dst.cast_static(dst);
 
 		if (future)
-			e_src->signal_pad_added().connect(sigc::ptr_fun(&ConnectCommand::element_pad_added));
+		{
+			connect_future_elements(e_src, e_dst);
+			connect_pad_added_handler(e_src);
+		}
 		else
 			e_src->link(e_dst);
 	}
@@ -218,9 +222,11 @@ void ConnectCommand::run_command(std::vector<CommandListener*> listeners)
 		if (future)
 		{
 			RefPtr<PadTemplate> p_src = p_src.cast_static(src);
-			src_parent->signal_pad_added().connect(sigc::ptr_fun(&ConnectCommand::element_pad_added));
+			RefPtr<Pad> p_dst = p_dst.cast_static(dst);
+			connect_future_pads(src_parent, p_src, p_dst);
+			connect_pad_added_handler(src_parent);
 			for (auto listener : listeners)
-				listener->future_connection_added(p_src, src_parent, RefPtr<Pad>::cast_static(dst));
+				listener->future_connection_added(p_src, src_parent, p_dst);
 		}
 		else
 		{
@@ -231,6 +237,11 @@ void ConnectCommand::run_command(std::vector<CommandListener*> listeners)
 	}
 }
 
+Command* ConnectCommand::get_inverse()
+{
+	return new DisconnectCommand(src, dst, future);
+}
+
 vector<string> ConnectCommand::get_suggestions(const vector<string>& args, const RefPtr<Pipeline>& model)
 {
 	try
@@ -241,8 +252,26 @@ vector<string> ConnectCommand::get_suggestions(const vector<string>& args, const
 
 		if (args.size() == 1)
 			return EnumUtils<ObjectType>::get_string_values();
-		else if ((args.size() == 2 || args.size() == 4) && type == ObjectType::ELEMENT)
+		else if (args.size() == 2 && type == ObjectType::ELEMENT)
 			return GstUtils::get_elements_from_bin_string(model, false);
+		else if (args.size() == 4 && type == ObjectType::ELEMENT)
+		{
+			auto elements = GstUtils::get_elements_from_bin_string(model, false);
+			auto matrix = LinkMatrix::get();
+			int src_factory = matrix ? matrix->find_factory(GstUtils::find_element(args[1], model)) : -1;
+
+			if (src_factory < 0)
+				return elements;
+
+			vector<string> values;
+			for (auto element : elements)
+			{
+				int sink_factory = matrix->find_factory(GstUtils::find_element(element, model));
+				if (sink_factory < 0 || matrix->can_link(src_factory, sink_factory))
+					values.push_back(element);
+			}
+			return values;
+		}
 		else if (args.size() == 2 && type == ObjectType::PAD)
 		{
 			auto a = GstUtils::get_elements_from_bin_string(model, false);
@@ -13,10 +13,11 @@ using namespace Gst;
 using Glib::RefPtr;
 using namespace std;
 
-DisconnectCommand::DisconnectCommand(const RefPtr<Object>& src, const RefPtr<Object>& dst)
+DisconnectCommand::DisconnectCommand(const RefPtr<Object>& src, const RefPtr<Object>& dst, bool future)
 : Command(CommandType::DISCONNECT),
   src(src),
-  dst(dst)
+  dst(dst),
+  future(future)
 {
 	if (GST_IS_ELEMENT(src->gobj()) || GST_IS_ELEMENT(dst->gobj()))
 		type = ObjectType::ELEMENT;
@@ -59,7 +60,11 @@ void DisconnectCommand::run_command(std::vector<CommandListener*> listeners)
 	{
 		RefPtr<Element> e_src = e_src.cast_static(src),
 				e_dst = e_dst.cast_static(dst);
-		e_src->unlink(e_dst);
+
+		if (future)
+			ConnectCommand::remove_future_connection(e_src, e_dst);
+		else
+			e_src->unlink(e_dst);
 	}
 	else
 	{
@@ -68,7 +73,13 @@ void DisconnectCommand::run_command(std::vector<CommandListener*> listeners)
 		if (GST_IS_PAD_TEMPLATE(src->gobj()))
 		{
 			RefPtr<PadTemplate> p_src = p_src.cast_static(src);
-			ConnectCommand::remove_future_connection(p_src, p_dst, listeners);
+
+			for (auto connection : FutureConnectionTable::get(p_dst).get_pad_connections())
+				if (connection.first.second == p_src && connection.second == p_dst)
+					src_parent = connection.first.first;
+
+			if (src_parent)
+				ConnectCommand::remove_future_connection(src_parent, p_src, p_dst, listeners);
 		}
 		else
 		{
@@ -78,6 +89,14 @@ void DisconnectCommand::run_command(std::vector<CommandListener*> listeners)
 	}
 }
 
+Command* DisconnectCommand::get_inverse()
+{
+	if (GST_IS_PAD_TEMPLATE(src->gobj()))
+		return src_parent ? new ConnectCommand(RefPtr<PadTemplate>::cast_static(src), src_parent, RefPtr<Pad>::cast_static(dst)) : nullptr;
+
+	return new ConnectCommand(src, dst, future);
+}
+
 vector<string> DisconnectCommand::get_suggestions(const vector<string>& args, const RefPtr<Pipeline>& model)
 {
 	try
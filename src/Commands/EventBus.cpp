@@ -0,0 +1,122 @@
+/*
+ * EventBus.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "EventBus.h"
+#include <QCoreApplication>
+#include <QThread>
+#include <unordered_map>
+
+EventBus::EventBus()
+: scheduled(false),
+  dispatching(false)
+{
+	if (QCoreApplication::instance())
+		moveToThread(QCoreApplication::instance()->thread());
+}
+
+EventBus& EventBus::get()
+{
+	static EventBus* bus = new EventBus();
+
+	return *bus;
+}
+
+void EventBus::notify(const Event& event)
+{
+	for (auto listener : *event.listeners)
+	{
+		if (listener == nullptr || CommandListener::get_refcount() <= 0)
+			continue;
+
+		switch (event.type)
+		{
+		case EventType::PAD_ADDED:
+			listener->pad_added(event.pad);
+			break;
+		case EventType::PAD_REMOVED:
+			listener->pad_removed(event.pad);
+			break;
+		case EventType::PAD_LINKED:
+			listener->pad_linked(event.pad);
+			break;
+		case EventType::PAD_UNLINKED:
+			listener->pad_unlinked(event.pad);
+			break;
+		}
+	}
+}
+
+void EventBus::post(EventType type, const Glib::RefPtr<Gst::Pad>& pad, const listener_list& listeners)
+{
+	if (!listeners || listeners->empty())
+		return;
+
+	// without an event loop there is no GUI thread to marshal to
+	if (!QCoreApplication::instance())
+	{
+		notify({type, pad, listeners});
+		return;
+	}
+
+	queue.push({type, pad, listeners});
+
+	// changes made by the GUI thread itself are delivered immediately, in order with queued events
+	if (QThread::currentThread() == thread())
+		flush();
+	else if (!scheduled.exchange(true))
+		QMetaObject::invokeMethod(this, "process", Qt::QueuedConnection);
+}
+
+void EventBus::process()
+{
+	scheduled.store(false);
+	flush();
+}
+
+void EventBus::flush()
+{
+	// events posted by listeners are picked up by the outer loop
+	if (dispatching)
+		return;
+
+	dispatching = true;
+
+	std::vector<Event> batch;
+	Event event;
+
+	try
+	{
+		while (true)
+		{
+			batch.clear();
+			while (queue.pop(event))
+				batch.push_back(std::move(event));
+
+			if (batch.empty())
+				break;
+
+			std::unordered_map<GstPad*, EventType> last_event;
+
+			for (auto& e : batch)
+			{
+				auto it = last_event.find(e.pad->gobj());
+				if (it != last_event.end() && it->second == e.type)
+					continue;
+
+				last_event[e.pad->gobj()] = e.type;
+				notify(e);
+			}
+		}
+	}
+	catch (...)
+	{
+		dispatching = false;
+		throw;
+	}
+
+	dispatching = false;
+}
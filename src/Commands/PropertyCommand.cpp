@@ -9,6 +9,8 @@
 #include "utils/EnumUtils.h"
 #include "utils/GstUtils.h"
 #include "Properties/Property.h"
+#include <QApplication>
+#include <cstring>
 
 using namespace Gst;
 using Glib::RefPtr;
@@ -17,6 +19,7 @@ using namespace std;
 PropertyCommand::PropertyCommand(const RefPtr<Element>& element,
 		const string& property_name, const string& property_value)
 : Command(CommandType::PROPERTY),
+  property_name(property_name),
   element(element)
 {
 	run_window = property_name.empty();
@@ -32,6 +35,30 @@ PropertyCommand::PropertyCommand(const RefPtr<Element>& element,
 	}
 }
 
+PropertyCommand::PropertyCommand(const RefPtr<Element>& element,
+		const string& property_name, const shared_ptr<GValue>& value)
+: Command(CommandType::PROPERTY),
+  property(nullptr),
+  property_name(property_name),
+  value(value),
+  run_window(false),
+  element(element)
+{
+}
+
+static shared_ptr<GValue> make_value(GType type)
+{
+	shared_ptr<GValue> value(g_new0(GValue, 1), [](GValue* value) {
+		if (G_IS_VALUE(value))
+			g_value_unset(value);
+		g_free(value);
+	});
+
+	g_value_init(value.get(), type);
+
+	return value;
+}
+
 PropertyCommand::~PropertyCommand()
 {
 	delete property;
@@ -41,12 +68,44 @@ void PropertyCommand::run_command(std::vector<CommandListener*> listeners)
 {
 	if (run_window)
 	{
+		if (!QApplication::instance())
+			throw runtime_error("Cannot show properties window without GUI.");
+
 		Property::build_property_window(element)->show();
+		return;
 	}
-	else if (property != nullptr)
-		property->set_value();
-	else
+
+	GParamSpec* param = g_object_class_find_property(G_OBJECT_GET_CLASS(element->gobj()), property_name.c_str());
+
+	if (param == nullptr || (property == nullptr && !value))
 		throw runtime_error("Cannot set property. Property unavailable.");
+
+	previous_value = make_value(param->value_type);
+	g_object_get_property(G_OBJECT(element->gobj()), property_name.c_str(), previous_value.get());
+
+	if (value)
+		g_object_set_property(G_OBJECT(element->gobj()), property_name.c_str(), value.get());
+	else
+		property->set_value();
+}
+
+Command* PropertyCommand::get_inverse()
+{
+	if (!previous_value)
+		return nullptr;
+
+	return new PropertyCommand(element, property_name, previous_value);
+}
+
+size_t PropertyCommand::get_memory_size() const
+{
+	size_t size = sizeof(*this) + property_name.size();
+
+	for (auto v : {value, previous_value})
+		if (v && G_VALUE_HOLDS_STRING(v.get()) && g_value_get_string(v.get()))
+			size += strlen(g_value_get_string(v.get()));
+
+	return size;
 }
 
 PropertyCommand* PropertyCommand::from_args(const vector<string>& args, const RefPtr<Pipeline>& model)
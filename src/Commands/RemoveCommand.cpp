@@ -6,6 +6,9 @@
  */
 
 #include "RemoveCommand.h"
+#include "AddCommand.h"
+#include "ConnectCommand.h"
+#include "BatchCommand.h"
 #include "utils/EnumUtils.h"
 #include "utils/GstUtils.h"
 
@@ -25,20 +28,65 @@ RemoveCommand::~RemoveCommand()
 {
 }
 
+static void add_link(const RefPtr<Pad>& pad, std::vector<std::pair<RefPtr<Pad>, RefPtr<Pad>>>& links)
+{
+	RefPtr<Pad> peer = pad->get_peer();
+
+	if (peer)
+		links.push_back(pad->get_direction() == PAD_SRC ? std::make_pair(pad, peer) : std::make_pair(peer, pad));
+}
+
 void RemoveCommand::run_command(std::vector<CommandListener*> listeners)
 {
-	RefPtr<Object> parent = object->get_parent();
+	parent = parent.cast_static(object->get_parent());
+	links.clear();
+	future_pads.clear();
+	future_elements.clear();
+
+	// removed objects must not be kept alive and saved by future connections
+	if (parent)
+		FutureConnectionTable::get(parent).remove_object(object, future_pads, future_elements);
 
 	if (type == ObjectType::ELEMENT)
 	{
+		auto iterator = RefPtr<Element>::cast_static(object)->iterate_pads();
+		while (iterator.next())
+			add_link(*iterator, links);
+
 		RefPtr<Bin> bin = bin.cast_static(parent);
 		bin->remove(RefPtr<Element>::cast_static(object));
 	}
 	else if (type == ObjectType::PAD)
 	{
-		RefPtr<Element> element = element.cast_static(parent);
-		element->remove_pad(RefPtr<Pad>::cast_static(object));
+		add_link(RefPtr<Pad>::cast_static(object), links);
+		parent->remove_pad(RefPtr<Pad>::cast_static(object));
+	}
+}
+
+Command* RemoveCommand::get_inverse()
+{
+	if (!parent)
+		return nullptr;
+
+	// removing an object unlinks it, so the links are restored as well
+	BatchCommand* batch = new BatchCommand();
+	batch->add_command(new AddCommand(type, parent, object));
+
+	for (auto link : links)
+	{
+		RefPtr<Object> src = link.first, sink = link.second;
+		batch->add_command([src, sink] { return new ConnectCommand(src, sink); });
 	}
+
+	for (auto connection : future_elements)
+		batch->add_command([connection] { return new ConnectCommand(connection.first, connection.second, true); });
+
+	for (auto connection : future_pads)
+		batch->add_command([connection] {
+			return new ConnectCommand(connection.first.second, connection.first.first, connection.second);
+		});
+
+	return batch;
 }
 
 RemoveCommand* RemoveCommand::from_args(const vector<string>& args, const RefPtr<Pipeline>& model)
@@ -15,6 +15,8 @@ using namespace std;
 StateCommand::StateCommand(State state, const RefPtr<Gst::Pipeline>& model)
 : Command(CommandType::STATE),
   state(state),
+  previous_state(State::STOP),
+  was_run(false),
   model(model)
 {
 }
@@ -46,12 +48,25 @@ void StateCommand::run_command(std::vector<CommandListener*> listeners)
 		break;
 	}
 
+	Gst::State current, pending;
+	model->get_state(current, pending, 0);
+	Gst::State target = (pending != Gst::STATE_VOID_PENDING) ? pending : current;
+
+	previous_state = (target == Gst::STATE_PLAYING) ? State::PLAY :
+			(target == Gst::STATE_PAUSED) ? State::PAUSE : State::STOP;
+	was_run = true;
+
 	for (auto listener : listeners)
 		listener->state_changed(state);
 
 	model->set_state(gst_state);
 }
 
+Command* StateCommand::get_inverse()
+{
+	return was_run ? new StateCommand(previous_state, model) : nullptr;
+}
+
 vector<string> StateCommand::get_suggestions(const vector<string>& args, const RefPtr<Gst::Pipeline>& model)
 {
 	if (args.size() == 1)
@@ -0,0 +1,131 @@
+/*
+ * UndoStack.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "UndoStack.h"
+#include <stdexcept>
+
+UndoStack::UndoStack(size_t capacity, size_t memory_limit)
+: buffer(capacity > 0 ? capacity : 1),
+  first(0),
+  size(0),
+  position(0),
+  memory_size(0),
+  memory_limit(memory_limit)
+{
+}
+
+void UndoStack::drop_oldest()
+{
+	memory_size -= at(0)->get_memory_size();
+	at(0).reset();
+	first = (first + 1) % buffer.size();
+	size--;
+
+	if (position > 0)
+		position--;
+}
+
+void UndoStack::drop_newest()
+{
+	memory_size -= at(size - 1)->get_memory_size();
+	at(size - 1).reset();
+	size--;
+
+	if (position > size)
+		position = size;
+}
+
+void UndoStack::drop_redo()
+{
+	while (size > position)
+		drop_newest();
+}
+
+// drops the oldest undo entries first, then the farthest redo ones; the entry at `keep` is always kept
+void UndoStack::trim(size_t keep)
+{
+	while (memory_size > memory_limit && size > 1)
+	{
+		if (position > 0 && keep > 0)
+		{
+			drop_oldest();
+			keep--;
+		}
+		else if (keep < size - 1)
+			drop_newest();
+		else
+			break;
+	}
+}
+
+void UndoStack::push(const std::shared_ptr<Command>& command)
+{
+	drop_redo();
+
+	if (size == buffer.size())
+		drop_oldest();
+
+	at(size) = command;
+	size++;
+	position = size;
+	memory_size += command->get_memory_size();
+
+	// the newest entry is always kept, even if it alone exceeds the limit
+	trim(size - 1);
+}
+
+void UndoStack::step(size_t index, std::vector<CommandListener*> listeners)
+{
+	std::shared_ptr<Command> inverse(at(index)->get_inverse());
+
+	if (!inverse)
+		throw std::runtime_error("command cannot be reverted");
+
+	inverse->run_command(listeners);
+
+	memory_size -= at(index)->get_memory_size();
+	at(index) = inverse;
+	memory_size += inverse->get_memory_size();
+}
+
+void UndoStack::undo(std::vector<CommandListener*> listeners)
+{
+	if (!can_undo())
+		return;
+
+	step(position - 1, listeners);
+	position--;
+
+	// an inverse may be much larger than the command it replaces
+	trim(position);
+}
+
+void UndoStack::redo(std::vector<CommandListener*> listeners)
+{
+	if (!can_redo())
+		return;
+
+	step(position, listeners);
+	position++;
+
+	trim(position - 1);
+}
+
+void UndoStack::clear()
+{
+	for (auto& command : buffer)
+		command.reset();
+
+	first = size = position = memory_size = 0;
+}
+
+void UndoStack::set_memory_limit(size_t limit)
+{
+	memory_limit = limit;
+
+	trim(position > 0 ? position - 1 : 0);
+}
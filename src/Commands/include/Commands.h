@@ -15,6 +15,9 @@
 #include "Commands/DisconnectCommand.h"
 #include "Commands/PropertyCommand.h"
 #include "Commands/RemoveCommand.h"
+#include "Commands/BatchCommand.h"
+#include "Commands/UndoStack.h"
+#include "Commands/EventBus.h"
 #include "Commands/CommandListener.h"
 
 #endif /* COMMANDS_H_ */
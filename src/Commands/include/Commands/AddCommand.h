@@ -18,6 +18,7 @@ class AddCommand : public Command
 private:
 	Glib::RefPtr<Gst::Object> object;
 	Glib::RefPtr<Gst::Element> parent;
+	Glib::RefPtr<Gst::Object> added_object;
 	ObjectType type;
 
 	static AddCommand* generate_add_pad_command(const std::vector<std::string>& args, const Glib::RefPtr<Gst::Pipeline>& model);
@@ -33,8 +34,12 @@ public:
 
 	void run_command(std::vector<CommandListener*> listeners = {});
 	Glib::RefPtr<Gst::Object> run_command_ret(std::vector<CommandListener*> listeners = {});
+	Command* get_inverse();
+	bool is_reversible() const { return bool(added_object); }
 
 	Glib::RefPtr<Gst::Object> get_object() { return object; }
+	Glib::RefPtr<Gst::Element> get_parent() { return parent; }
+	ObjectType get_object_type() { return type; }
 };
 
 #endif /* ADDCOMMAND_H_ */
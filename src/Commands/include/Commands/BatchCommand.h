@@ -0,0 +1,56 @@
+/*
+ * BatchCommand.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef BATCHCOMMAND_H_
+#define BATCHCOMMAND_H_
+
+#include "Command.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * Runs a group of commands as a single transaction. Listeners see one bulk
+ * update; if any command fails, commands already run are reverted in
+ * reverse order and the error is rethrown.
+ */
+class BatchCommand : public Command
+{
+public:
+	typedef std::function<Command*()> command_builder;
+
+private:
+	// commands may refer to objects created by earlier commands of the batch,
+	// so they can be built lazily, right before they are run
+	struct Entry
+	{
+		std::shared_ptr<Command> command;
+		command_builder builder;
+	};
+
+	std::vector<Entry> entries;
+	size_t executed_count;
+	std::vector<CommandListener*> listeners;
+
+public:
+	BatchCommand();
+	virtual ~BatchCommand();
+
+	void add_command(Command* command);
+	void add_command(const command_builder& builder);
+	size_t get_command_count() const { return entries.size(); }
+
+	void run_command(std::vector<CommandListener*> listeners = {});
+	// returns errors of commands which couldn't be reverted, or an empty string
+	std::string rollback();
+	Command* get_inverse();
+	bool is_reversible() const { return true; }
+	size_t get_memory_size() const;
+};
+
+#endif /* BATCHCOMMAND_H_ */
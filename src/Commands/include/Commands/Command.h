@@ -23,6 +23,7 @@ enum class CommandType
 	DISCONNECT,
 	PROPERTY,
 	STATE,
+	BATCH,
 };
 
 enum class ObjectType
@@ -68,6 +69,13 @@ public:
 
 	virtual void run_command(std::vector<CommandListener*> listeners = {}) = 0;
 
+	// command reverting the last run of this command, or nullptr if it cannot be reverted
+	virtual Command* get_inverse() { return nullptr; }
+	// whether get_inverse() returns a command; unlike get_inverse(), it never creates one
+	virtual bool is_reversible() const { return false; }
+	// approximate memory used by the command, for limiting the undo history
+	virtual size_t get_memory_size() const { return 64; }
+
 	static void syntax_error(const std::string& error)
 	{
 		throw std::runtime_error("Syntax error: " + error);
@@ -10,6 +10,8 @@
 
 #include "ConnectCommand.h"
 #include <gstreamermm.h>
+#include <memory>
+#include <vector>
 
 class CommandListener
 {
@@ -24,8 +26,32 @@ public:
 			const Glib::RefPtr<Gst::Element>& parent, const Glib::RefPtr<Gst::Pad>& sink){}
 	virtual void future_connection_removed(const ConnectCommand::future_connection_pads& conn){}
 	virtual void state_changed(State state){}
+	virtual void bulk_update_started(){}
+	virtual void bulk_update_finished(){}
+	virtual void command_executed(const std::shared_ptr<Command>& command){}
 	static int get_refcount() { return refcount; }
 	virtual ~CommandListener(){}
 };
 
+class BulkUpdateScope
+{
+private:
+	std::vector<CommandListener*> listeners;
+public:
+	explicit BulkUpdateScope(const std::vector<CommandListener*>& listeners)
+	: listeners(listeners)
+	{
+		for (auto listener : listeners)
+			if (listener != nullptr)
+				listener->bulk_update_started();
+	}
+
+	~BulkUpdateScope()
+	{
+		for (auto listener : listeners)
+			if (listener != nullptr)
+				listener->bulk_update_finished();
+	}
+};
+
 #endif /* COMMANDLISTENER_H_ */
@@ -9,18 +9,18 @@
 #define CONNECTCOMMAND_H_
 
 #include "Command.h"
+#include "utils/FutureConnectionTable.h"
 #include "utils/GstUtils.h"
 
 #include <gstreamermm.h>
-#include <set>
 #include <utility>
 
 class ConnectCommand : public Command
 {
 public:
-	typedef std::pair<Glib::RefPtr<Gst::Element>, Glib::RefPtr<Gst::PadTemplate>> template_parent;
-	typedef std::pair<template_parent, Glib::RefPtr<Gst::Pad>> future_connection_pads;
-	typedef std::pair<Glib::RefPtr<Gst::Element>, Glib::RefPtr<Gst::Element>> future_connection_elements;
+	typedef FutureConnectionTable::template_parent template_parent;
+	typedef FutureConnectionTable::pad_connection future_connection_pads;
+	typedef FutureConnectionTable::element_connection future_connection_elements;
 private:
 	Glib::RefPtr<Gst::Object> src;
 	Glib::RefPtr<Gst::Object> dst;
@@ -28,9 +28,6 @@ private:
 	bool future;
 	ObjectType type;
 
-	static std::set<future_connection_pads> future_connection_pads_map;
-	static std::set<future_connection_elements> future_connection_elements_map;
-
 	static std::string future_keyword;
 	void connect_future_pads(const Glib::RefPtr<Gst::Element>& src_parent, const Glib::RefPtr<Gst::PadTemplate>& src_pad, const Glib::RefPtr<Gst::Pad>& sink_pad);
 	void connect_future_elements(const Glib::RefPtr<Gst::Element>& src, const Glib::RefPtr<Gst::Element>& sink);
@@ -41,16 +38,19 @@ public:
 	ObjectType get_type() { return type; }
 	Glib::RefPtr<Gst::Object> get_src() { return src; }
 	Glib::RefPtr<Gst::Object> get_dst() { return dst; }
+	Glib::RefPtr<Gst::Element> get_src_parent() { return src_parent; }
+	bool is_future() { return future; }
 	static ConnectCommand* from_args(const std::vector<std::string>& args, const Glib::RefPtr<Gst::Pipeline>& model);
 	static ConnectCommand* from_linkage(const Linkage& lnk, std::vector<CommandListener*> listeners);
 	static std::vector<std::string> get_suggestions(const std::vector<std::string>& args, const Glib::RefPtr<Gst::Pipeline>& model);
 	void run_command(std::vector<CommandListener*> listeners = {});
+	Command* get_inverse();
+	bool is_reversible() const { return true; }
 
 	static void element_pad_added(const Glib::RefPtr<Gst::Pad>& pad);
-	static void remove_future_connection(const Glib::RefPtr<Gst::PadTemplate>& tpl, const Glib::RefPtr<Gst::Pad>& pad, std::vector<CommandListener*> listeners = {});
-
-	static std::set<future_connection_elements> get_future_connections_element();
-	static std::set<future_connection_pads> get_future_connections_pads();
+	static void remove_future_connection(const Glib::RefPtr<Gst::Element>& parent, const Glib::RefPtr<Gst::PadTemplate>& tpl,
+			const Glib::RefPtr<Gst::Pad>& pad, std::vector<CommandListener*> listeners = {});
+	static void remove_future_connection(const Glib::RefPtr<Gst::Element>& src, const Glib::RefPtr<Gst::Element>& sink);
 };
 
 #endif /* CONNECTCOMMAND_H_ */
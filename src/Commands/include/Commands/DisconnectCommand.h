@@ -16,13 +16,20 @@ class DisconnectCommand : public Command
 private:
 	Glib::RefPtr<Gst::Object> src;
 	Glib::RefPtr<Gst::Object> dst;
+	Glib::RefPtr<Gst::Element> src_parent;
+	bool future;
 	ObjectType type;
 public:
-	DisconnectCommand(const Glib::RefPtr<Gst::Object>& src, const Glib::RefPtr<Gst::Object>& dst);
+	DisconnectCommand(const Glib::RefPtr<Gst::Object>& src, const Glib::RefPtr<Gst::Object>& dst, bool future = false);
 
 	static DisconnectCommand* from_args(const std::vector<std::string>& args, const Glib::RefPtr<Gst::Pipeline>& model);
 	static std::vector<std::string> get_suggestions(const std::vector<std::string>& args, const Glib::RefPtr<Gst::Pipeline>& model);
 	void run_command(std::vector<CommandListener*> listeners = {});
+	Command* get_inverse();
+	bool is_reversible() const { return !GST_IS_PAD_TEMPLATE(src->gobj()) || src_parent; }
+
+	Glib::RefPtr<Gst::Object> get_src() { return src; }
+	Glib::RefPtr<Gst::Object> get_dst() { return dst; }
 };
 
 #endif /* DISCONNECTCOMMAND_H_ */
@@ -0,0 +1,64 @@
+/*
+ * EventBus.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef EVENTBUS_H_
+#define EVENTBUS_H_
+
+#include "CommandListener.h"
+#include "utils/MpscQueue.h"
+#include <QObject>
+#include <gstreamermm.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/*
+ * Delivers pad events to command listeners in the GUI thread. Events emitted
+ * by streaming threads are queued and dispatched in batches; an event repeating
+ * the previous one for the same pad within a batch is dropped.
+ */
+class EventBus : public QObject
+{
+	Q_OBJECT
+public:
+	enum class EventType
+	{
+		PAD_ADDED,
+		PAD_REMOVED,
+		PAD_LINKED,
+		PAD_UNLINKED
+	};
+
+	typedef std::shared_ptr<const std::vector<CommandListener*>> listener_list;
+
+private:
+	struct Event
+	{
+		EventType type;
+		Glib::RefPtr<Gst::Pad> pad;
+		listener_list listeners;
+	};
+
+	MpscQueue<Event> queue;
+	std::atomic<bool> scheduled;
+	bool dispatching;
+
+	EventBus();
+
+	static void notify(const Event& event);
+
+private Q_SLOTS:
+	void process();
+
+public:
+	static EventBus& get();
+
+	void post(EventType type, const Glib::RefPtr<Gst::Pad>& pad, const listener_list& listeners);
+	void flush();
+};
+
+#endif /* EVENTBUS_H_ */
@@ -13,12 +13,17 @@
 #include "Command.h"
 #include "Properties/Property.h"
 #include <vector>
+#include <memory>
 #include <gstreamermm.h>
 
 class PropertyCommand : public Command
 {
 private:
 	Property* property;
+	std::string property_name;
+	// values are kept as GValues, so undo records only the changed property
+	std::shared_ptr<GValue> value;
+	std::shared_ptr<GValue> previous_value;
 	bool run_window;
 	Glib::RefPtr<Gst::Element> element;
 
@@ -27,11 +32,21 @@ public:
 			const Glib::RefPtr<Gst::Element>& element,
 			const std::string& property_name,
 			const std::string& property_value);
+	PropertyCommand(
+			const Glib::RefPtr<Gst::Element>& element,
+			const std::string& property_name,
+			const std::shared_ptr<GValue>& value);
 	virtual ~PropertyCommand();
 
 	static PropertyCommand* from_args(const std::vector<std::string>& vect, const Glib::RefPtr<Gst::Pipeline>& model);
 	static std::vector<std::string> get_suggestions(const std::vector<std::string>& args, const Glib::RefPtr<Gst::Pipeline>& model);
 	void run_command(std::vector<CommandListener*> listeners = {});
+	Command* get_inverse();
+	bool is_reversible() const { return previous_value != nullptr; }
+	size_t get_memory_size() const;
+
+	Glib::RefPtr<Gst::Element> get_element() { return element; }
+	std::string get_property_name() { return property_name; }
 };
 
 
@@ -9,7 +9,9 @@
 #define REMOVECOMMAND_H_
 
 #include "Command.h"
+#include "utils/FutureConnectionTable.h"
 #include <vector>
+#include <utility>
 #include <gstreamermm.h>
 
 class RemoveCommand : public Command
@@ -17,6 +19,9 @@ class RemoveCommand : public Command
 private:
 	Glib::RefPtr<Gst::Object> object;
 	Glib::RefPtr<Gst::Element> parent;
+	std::vector<std::pair<Glib::RefPtr<Gst::Pad>, Glib::RefPtr<Gst::Pad>>> links;
+	std::vector<FutureConnectionTable::pad_connection> future_pads;
+	std::vector<FutureConnectionTable::element_connection> future_elements;
 	ObjectType type;
 
 public:
@@ -28,6 +33,11 @@ public:
 	static std::vector<std::string> get_suggestions(const std::vector<std::string>& args, const Glib::RefPtr<Gst::Pipeline>& model);
 
 	void run_command(std::vector<CommandListener*> listeners = {});
+	Command* get_inverse();
+	bool is_reversible() const { return bool(parent); }
+
+	Glib::RefPtr<Gst::Object> get_object() { return object; }
+	ObjectType get_object_type() { return type; }
 };
 
 #endif /* REMOVECOMMAND_H_ */
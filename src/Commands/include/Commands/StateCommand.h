@@ -14,6 +14,8 @@
 class StateCommand : public Command
 {
 	State state;
+	State previous_state;
+	bool was_run;
 	Glib::RefPtr<Gst::Pipeline> model;
 public:
 	StateCommand(State state, const Glib::RefPtr<Gst::Pipeline>& model);
@@ -21,6 +23,8 @@ public:
 	static StateCommand* from_args(const std::vector<std::string>& vect, const Glib::RefPtr<Gst::Pipeline>& model);
 	static std::vector<std::string> get_suggestions(const std::vector<std::string>& args, const Glib::RefPtr<Gst::Pipeline>& model);
 	void run_command(std::vector<CommandListener*> listeners = {});
+	Command* get_inverse();
+	bool is_reversible() const { return was_run; }
 };
 
 #endif /* STATECOMMAND_H_ */
@@ -0,0 +1,51 @@
+/*
+ * UndoStack.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef UNDOSTACK_H_
+#define UNDOSTACK_H_
+
+#include "Command.h"
+#include <memory>
+#include <vector>
+
+/*
+ * Undo/redo history stored in a fixed-size ring buffer. Every entry keeps the
+ * command that was run last, so both undo and redo run its inverse.
+ * The oldest entries are dropped when the capacity or memory limit is exceeded.
+ */
+class UndoStack
+{
+private:
+	std::vector<std::shared_ptr<Command>> buffer;
+	size_t first;
+	size_t size;
+	size_t position;
+	size_t memory_size;
+	size_t memory_limit;
+
+	std::shared_ptr<Command>& at(size_t index) { return buffer[(first + index) % buffer.size()]; }
+	void drop_oldest();
+	void drop_newest();
+	void drop_redo();
+	void trim(size_t keep);
+	void step(size_t index, std::vector<CommandListener*> listeners);
+
+public:
+	explicit UndoStack(size_t capacity = 256, size_t memory_limit = 8 * 1024 * 1024);
+
+	void push(const std::shared_ptr<Command>& command);
+	void undo(std::vector<CommandListener*> listeners = {});
+	void redo(std::vector<CommandListener*> listeners = {});
+	void clear();
+
+	bool can_undo() const { return position > 0; }
+	bool can_redo() const { return position < size; }
+	size_t get_memory_size() const { return memory_size; }
+	void set_memory_limit(size_t limit);
+};
+
+#endif /* UNDOSTACK_H_ */
@@ -63,5 +63,36 @@ void CommandParser::build_command()
 	case CommandType::DISCONNECT:
 		command = DisconnectCommand::from_args(command_args, model);
 		break;
+	case CommandType::BATCH:
+		command = build_batch_command();
+		break;
 	}
 }
+
+BatchCommand* CommandParser::build_batch_command()
+{
+	std::string text = StringUtils::join(command_args, " ");
+	BatchCommand* batch = new BatchCommand();
+	Glib::RefPtr<Gst::Pipeline> model = this->model;
+
+	// commands are parsed when the batch runs, so they can use elements added earlier in the batch
+	for (auto command_text : StringUtils::split(text, ";"))
+	{
+		command_text = StringUtils::trim(command_text);
+
+		if (command_text.empty())
+			continue;
+
+		batch->add_command([model, command_text] {
+			return CommandParser(model).parse(command_text);
+		});
+	}
+
+	if (batch->get_command_count() == 0)
+	{
+		delete batch;
+		Command::syntax_error("expected commands separated by `;`");
+	}
+
+	return batch;
+}
@@ -8,11 +8,17 @@
 #include "ConsoleView.h"
 #include "utils/EnumUtils.h"
 #include "utils/StringUtils.h"
+#include "utils/ElementPathIndex.h"
+#include <algorithm>
+#include <iterator>
 
 ConsoleView::ConsoleView(std::vector<CommandListener*> listeners, QWidget* parent)
 : QWidget(parent),
   listeners(listeners),
-  parser(nullptr)
+  parser(nullptr),
+  suggestion_index_valid(false),
+  suggestion_revision(0),
+  suggestion_cookie(0)
 {
 	edit = new QLineEdit();
 	button = new QPushButton("Execute");
@@ -119,6 +125,8 @@ void ConsoleView::execute_command()
 	{
 		std::shared_ptr<Command> cmd(parser->parse(edit->text().toUtf8().constData()));
 		cmd->run_command(listeners);
+		for (auto listener : listeners)
+			listener->command_executed(cmd);
 		Q_EMIT command_added(cmd);
 		//edit->clear();
 	}
@@ -135,6 +143,7 @@ void ConsoleView::set_model(const Glib::RefPtr<Gst::Pipeline>& model)
 	delete parser;
 	this->model = model;
 	parser = new CommandParser(model);
+	suggestion_index_valid = false;
 }
 
 void ConsoleView::suggest(const QString& text)
@@ -151,17 +160,16 @@ void ConsoleView::make_suggestion(const QString& text, bool autocomplete)
 		command_args.push_back("");
 	std::string cur_text = command_args.back();
 	std::string upper_cur_text = StringUtils::to_upper(cur_text);
-	std::vector<std::string> vals = get_current_suggestions(command_args);
 
-	for (size_t i = 0; i < vals.size(); i++)
+	update_suggestion_index(command_args);
+	std::vector<std::string> vals = suggestion_index.find(cur_text);
+
+	if (upper_cur_text != cur_text)
 	{
-		if (cur_text.size() > vals[i].size() ||
-				(vals[i].substr(0, cur_text.size()) != cur_text &&
-						vals[i].substr(0, cur_text.size()) != upper_cur_text))
-		{
-			vals.erase(vals.begin() + i);
-			i--;
-		}
+		std::vector<std::string> upper_vals = suggestion_index.find(upper_cur_text);
+		std::vector<std::string> merged;
+		std::merge(vals.begin(), vals.end(), upper_vals.begin(), upper_vals.end(), std::back_inserter(merged));
+		vals = merged;
 	}
 
 	if (vals.size() == 0)
@@ -202,6 +210,25 @@ void ConsoleView::make_suggestion(const QString& text, bool autocomplete)
 }
 
 
+void ConsoleView::update_suggestion_index(const std::vector<std::string>& command_args)
+{
+	// candidates depend only on the preceding arguments, the model and the registry,
+	// so while the last argument is being typed only the prefix lookup is done
+	std::string context = StringUtils::join(std::vector<std::string>(command_args.begin(), command_args.end() - 1), " ");
+	unsigned long revision = model ? ElementPathIndex::get(model).get_revision() : 0;
+	guint32 cookie = gst_registry_get_feature_list_cookie(gst_registry_get());
+
+	if (suggestion_index_valid && context == suggestion_context &&
+			revision == suggestion_revision && cookie == suggestion_cookie)
+		return;
+
+	suggestion_index = PrefixIndex(get_current_suggestions(command_args));
+	suggestion_context = context;
+	suggestion_revision = revision;
+	suggestion_cookie = cookie;
+	suggestion_index_valid = true;
+}
+
 std::vector<std::string> ConsoleView::get_current_suggestions(std::vector<std::string> command_args)
 {
 	if (command_args.size() < 2)
@@ -226,6 +253,8 @@ std::vector<std::string> ConsoleView::get_current_suggestions(std::vector<std::s
 			return RemoveCommand::get_suggestions(command_args, model);
 		case CommandType::DISCONNECT:
 			return DisconnectCommand::get_suggestions(command_args, model);
+		case CommandType::BATCH:
+			return std::vector<std::string>();
 		}
 	}
 	catch (...)
@@ -0,0 +1,63 @@
+/*
+ * ScriptRunner.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "ScriptRunner.h"
+#include "utils/StringUtils.h"
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+
+ScriptRunner::ScriptRunner(const Glib::RefPtr<Gst::Pipeline>& model, const std::vector<CommandListener*>& listeners)
+: model(model),
+  listeners(listeners),
+  executed_count(0)
+{
+}
+
+void ScriptRunner::run(std::istream& input)
+{
+	BulkUpdateScope bulk_update(listeners);
+	CommandParser parser(model);
+	std::string line;
+	size_t line_number = 0;
+
+	while (std::getline(input, line))
+	{
+		line_number++;
+		std::replace_if(line.begin(), line.end(), [](char c) { return c == '\t' || c == '\r'; }, ' ');
+		line = StringUtils::trim(line);
+
+		if (line.empty() || line[0] == '#')
+			continue;
+
+		try
+		{
+			std::shared_ptr<Command> cmd(parser.parse(line));
+			cmd->run_command(listeners);
+
+			for (auto listener : listeners)
+				listener->command_executed(cmd);
+		}
+		catch (const std::exception& ex)
+		{
+			throw std::runtime_error("line " + std::to_string(line_number) + ": " + ex.what());
+		}
+
+		executed_count++;
+	}
+}
+
+void ScriptRunner::run_file(const std::string& filename)
+{
+	std::ifstream input(filename);
+
+	if (!input.is_open())
+		throw std::runtime_error("Cannot open file `" + filename + "`");
+
+	run(input);
+}
@@ -10,5 +10,6 @@
 
 #include "Console/ConsoleView.h"
 #include "Console/ConsoleParser.h"
+#include "Console/ScriptRunner.h"
 
 #endif /* CONSOLE_H_ */
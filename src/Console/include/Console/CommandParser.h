@@ -21,6 +21,7 @@ private:
 	Glib::RefPtr<Gst::Pipeline> model;
 
 	void build_command();
+	BatchCommand* build_batch_command();
 public:
 	CommandParser(const Glib::RefPtr<Gst::Pipeline>& model);
 	virtual ~CommandParser();
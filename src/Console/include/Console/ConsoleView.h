@@ -9,6 +9,7 @@
 #define CONSOLEVIEW_H_
 
 #include "Console/CommandParser.h"
+#include "utils/PrefixIndex.h"
 #include <QWidget>
 #include <QtWidgets>
 #include <gstreamermm.h>
@@ -27,6 +28,13 @@ private:
 	CommandParser* parser;
 	std::vector<std::string> command_args;
 
+	PrefixIndex suggestion_index;
+	bool suggestion_index_valid;
+	std::string suggestion_context;
+	unsigned long suggestion_revision;
+	guint32 suggestion_cookie;
+
+	void update_suggestion_index(const std::vector<std::string>& command_args);
 	std::vector<std::string> get_current_suggestions(std::vector<std::string> command_args);
 	void make_suggestion_widget();
 	bool eventFilter(QObject *obj, QEvent *ev);
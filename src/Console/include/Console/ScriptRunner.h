@@ -0,0 +1,37 @@
+/*
+ * ScriptRunner.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef SCRIPTRUNNER_H_
+#define SCRIPTRUNNER_H_
+
+#include "CommandParser.h"
+#include <gstreamermm.h>
+#include <istream>
+#include <string>
+#include <vector>
+
+/*
+ * Executes console commands read from a file, one command per line.
+ * Empty lines and lines starting with `#` are skipped.
+ */
+class ScriptRunner
+{
+private:
+	Glib::RefPtr<Gst::Pipeline> model;
+	std::vector<CommandListener*> listeners;
+	size_t executed_count;
+
+public:
+	ScriptRunner(const Glib::RefPtr<Gst::Pipeline>& model, const std::vector<CommandListener*>& listeners = {});
+
+	void run(std::istream& input);
+	void run_file(const std::string& filename);
+
+	size_t get_executed_count() const { return executed_count; }
+};
+
+#endif /* SCRIPTRUNNER_H_ */
@@ -118,37 +118,33 @@ int ObjectInspectorModel::rowCount(const QModelIndex &parent) const
 
 void ObjectInspectorModel::setup_model_data()
 {
-	RefPtr<Registry> registry = Registry::get();
+	auto snapshot = RegistrySnapshot::get();
 
 	delete root_item;
 	root_item = new ObjectInspectorItem("");
 
-	for (RefPtr<Plugin> plugin : registry->get_plugin_list())
-		add_plugin_to_model(plugin);
+	for (auto& plugin : snapshot->get_plugins())
+		add_plugin_to_model(*snapshot, plugin);
 }
 
-void ObjectInspectorModel::add_plugin_to_model(const RefPtr<Plugin>& plugin)
+void ObjectInspectorModel::add_plugin_to_model(const RegistrySnapshot& snapshot, const RegistrySnapshot::PluginInfo& plugin)
 {
-	if (GST_OBJECT_FLAG_IS_SET (plugin->gobj(), GST_PLUGIN_FLAG_BLACKLISTED))
+	if (plugin.blacklisted)
 		return;
 
-	RefPtr<Registry> registry = Registry::get();
-	PluginItem* plugin_item = new PluginItem(plugin, root_item);
+	PluginItem* plugin_item = new PluginItem(plugin.name, plugin.description, root_item);
 
 	root_item->append_child(plugin_item);
 
-	Glib::ListHandle<RefPtr<PluginFeature>> features = registry->get_feature_list(plugin->get_name());
-
-	for (auto feature : features)
+	for (size_t i = plugin.feature_begin; i < plugin.feature_end; i++)
 	{
-		if (!feature)
-			continue;
+		const RegistrySnapshot::FeatureInfo& feature = snapshot.get_features()[i];
 
-		FactoryType type = GST_IS_ELEMENT_FACTORY (feature->gobj()) ?
+		FactoryType type = (feature.type == RegistrySnapshot::FeatureType::ELEMENT_FACTORY) ?
 				FactoryType::ELEMENT_FACTORY :
 				FactoryType::TYPEFIND_FACTORY;
 
-		ObjectInspectorItem* item = new ObjectInspectorItem(feature->get_name().c_str(), type, plugin_item);
+		ObjectInspectorItem* item = new ObjectInspectorItem(feature.name, type, plugin_item);
 
 		plugin_item->append_child(item);
 	}
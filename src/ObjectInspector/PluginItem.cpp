@@ -7,20 +7,21 @@
 
 #include "PluginItem.h"
 
-PluginItem::PluginItem(const Glib::RefPtr<Gst::Plugin>& plugin,
+PluginItem::PluginItem(const std::string& name, const std::string& desc,
 		ObjectInspectorItem* parent)
 : ObjectInspectorItem("", FactoryType::UNKNOW_FACTORY, parent),
-  plugin(plugin)
+  name(name),
+  desc(desc)
 {}
 
 std::string PluginItem::get_name() const
 {
-	return plugin->get_name();
+	return name;
 }
 
 std::string PluginItem::get_desc() const
 {
-	return plugin->get_description();
+	return desc;
 }
 
 
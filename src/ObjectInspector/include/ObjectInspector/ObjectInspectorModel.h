@@ -10,6 +10,7 @@
 
 
 #include "ObjectInspectorItem.h"
+#include "utils/RegistrySnapshot.h"
 #include <gstreamermm.h>
 #include <QAbstractItemModel>
 #include <QModelIndex>
@@ -23,7 +24,7 @@ private:
 	std::vector<ObjectInspectorItem*> items;
 	ObjectInspectorItem* root_item;
 
-	void add_plugin_to_model(const Glib::RefPtr<Gst::Plugin>& plugin);
+	void add_plugin_to_model(const RegistrySnapshot& snapshot, const RegistrySnapshot::PluginInfo& plugin);
 
 	Q_OBJECT
 
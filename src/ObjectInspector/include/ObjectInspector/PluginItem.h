@@ -9,19 +9,20 @@
 #define PLUGINITEM_H_
 
 #include "../ObjectInspector/ObjectInspectorItem.h"
-#include <gstreamermm.h>
+#include <string>
 
 class PluginItem : public ObjectInspectorItem
 {
 public:
-	explicit PluginItem(const Glib::RefPtr<Gst::Plugin>& plugin,
+	PluginItem(const std::string& name, const std::string& desc,
 			ObjectInspectorItem* parent = 0);
 
 	virtual std::string get_name() const;
 	virtual std::string get_desc() const;
 
 private:
-	Glib::RefPtr<Gst::Plugin> plugin;
+	std::string name;
+	std::string desc;
 };
 
 
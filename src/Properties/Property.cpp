@@ -15,11 +15,9 @@ using Glib::RefPtr;
 Property::Property(GParamSpec* param_spec, const RefPtr<Element>& element)
 : was_built(false),
   param_spec(param_spec),
-  element(element)
+  element(element),
+  widget(nullptr)
 {
-	widget = new QWidget();
-	widget->setLayout(new QHBoxLayout());
-	widget->layout()->addWidget(new QLabel(param_spec->name));
 }
 
 Property::~Property()
@@ -29,8 +27,12 @@ Property::~Property()
 
 QWidget* Property::get_widget()
 {
+	// widgets are created on demand, so properties can be used without a QApplication
 	if (!was_built)
 	{
+		widget = new QWidget();
+		widget->setLayout(new QHBoxLayout());
+		widget->layout()->addWidget(new QLabel(param_spec->name));
 		build_widget();
 		was_built = true;
 	}
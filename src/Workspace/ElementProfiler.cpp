@@ -0,0 +1,199 @@
+/*
+ * ElementProfiler.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "ElementProfiler.h"
+#include <algorithm>
+
+constexpr int ElementProfiler::bucket_count;
+
+namespace {
+
+struct Entry
+{
+	const void* histogram;
+	GstClockTime time;
+};
+
+// buffers entered into elements by the current streaming thread, innermost last
+thread_local std::vector<Entry> entries;
+constexpr size_t max_entries = 32;
+
+}
+
+ElementProfiler::~ElementProfiler()
+{
+	detach_all();
+}
+
+GstPadProbeReturn ElementProfiler::probe_callback(GstPad* pad, GstPadProbeInfo* info, gpointer user_data)
+{
+	Probe* probe = static_cast<Probe*>(user_data);
+	Histogram* histogram = probe->histogram.get();
+	GstClockTime now = gst_util_get_timestamp();
+
+	auto it = std::find_if(entries.rbegin(), entries.rend(),
+			[histogram](const Entry& entry) { return entry.histogram == histogram; });
+
+	if (probe->is_sink)
+	{
+		if (it != entries.rend())
+			entries.erase(std::next(it).base());
+		else if (entries.size() == max_entries)
+			entries.erase(entries.begin());
+
+		entries.push_back({histogram, now});
+	}
+	else if (it != entries.rend())
+	{
+		GstClockTime elapsed = now - it->time;
+		int bucket = std::min(bucket_count - 1, elapsed ? (int) g_bit_storage(elapsed) : 0);
+		histogram->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	return GST_PAD_PROBE_OK;
+}
+
+void ElementProfiler::destroy_probe(gpointer user_data)
+{
+	delete static_cast<Probe*>(user_data);
+}
+
+GstClockTime ElementProfiler::bucket_limit(int bucket)
+{
+	return bucket == 0 ? 0 : (G_GUINT64_CONSTANT(1) << bucket) - 1;
+}
+
+void ElementProfiler::attach(GstElement* element)
+{
+	GstIterator* iterator = gst_element_iterate_pads(element);
+	GValue item = G_VALUE_INIT;
+	bool done = false;
+
+	while (!done)
+	{
+		switch (gst_iterator_next(iterator, &item))
+		{
+		case GST_ITERATOR_OK:
+			attach_pad(GST_PAD(g_value_get_object(&item)));
+			g_value_reset(&item);
+			break;
+		case GST_ITERATOR_RESYNC:
+			gst_iterator_resync(iterator);
+			break;
+		default:
+			done = true;
+		}
+	}
+
+	g_value_unset(&item);
+	gst_iterator_free(iterator);
+}
+
+void ElementProfiler::attach_pad(GstPad* pad)
+{
+	if (pads.count(pad))
+		return;
+
+	GstElement* element = gst_pad_get_parent_element(pad);
+
+	if (element == nullptr)
+		return;
+
+	auto& histogram = histograms[element];
+	if (!histogram)
+		histogram = std::make_shared<Histogram>();
+
+	gst_object_unref(element);
+
+	Probe* probe = new Probe{histogram, GST_PAD_IS_SINK(pad)};
+	gulong id = gst_pad_add_probe(pad,
+			static_cast<GstPadProbeType>(GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_BUFFER_LIST),
+			probe_callback, probe, destroy_probe);
+
+	if (id == 0)
+		return;
+
+	gst_object_ref(pad);
+	pads[pad] = id;
+}
+
+void ElementProfiler::detach_pad(GstPad* pad)
+{
+	auto it = pads.find(pad);
+
+	if (it == pads.end())
+		return;
+
+	gst_pad_remove_probe(pad, it->second);
+	pads.erase(it);
+	gst_object_unref(pad);
+}
+
+void ElementProfiler::detach(GstElement* element)
+{
+	histograms.erase(element);
+}
+
+void ElementProfiler::detach_all()
+{
+	while (!pads.empty())
+		detach_pad(pads.begin()->first);
+
+	histograms.clear();
+}
+
+bool ElementProfiler::get_percentiles(GstElement* element, Percentiles& percentiles) const
+{
+	auto it = histograms.find(element);
+
+	if (it == histograms.end())
+		return false;
+
+	guint64 counts[bucket_count];
+	guint64 total = 0;
+
+	for (int i = 0; i < bucket_count; i++)
+		total += counts[i] = it->second->buckets[i].load(std::memory_order_relaxed);
+
+	if (total == 0)
+		return false;
+
+	percentiles.count = total;
+	percentiles.p50 = percentiles.p99 = bucket_limit(bucket_count - 1);
+
+	guint64 cumulative = 0;
+	bool p50_found = false;
+
+	for (int i = 0; i < bucket_count; i++)
+	{
+		cumulative += counts[i];
+
+		if (!p50_found && cumulative * 2 >= total)
+		{
+			percentiles.p50 = bucket_limit(i);
+			p50_found = true;
+		}
+
+		if (cumulative * 100 >= total * 99)
+		{
+			percentiles.p99 = bucket_limit(i);
+			break;
+		}
+	}
+
+	return true;
+}
+
+std::vector<GstElement*> ElementProfiler::get_elements() const
+{
+	std::vector<GstElement*> elements;
+
+	for (const auto& histogram : histograms)
+		elements.push_back(histogram.first);
+
+	return elements;
+}
@@ -0,0 +1,89 @@
+/*
+ * LinkFeasibilityChecker.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "LinkFeasibilityChecker.h"
+#include "qnelibrary/qneport.h"
+
+using namespace Gst;
+using Glib::RefPtr;
+
+LinkFeasibilityChecker::LinkFeasibilityChecker(QObject* parent)
+: QObject(parent),
+  has_pending(false),
+  stopped(false),
+  latest_id(0)
+{
+	worker = std::thread(&LinkFeasibilityChecker::run, this);
+}
+
+LinkFeasibilityChecker::~LinkFeasibilityChecker()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopped = true;
+		has_pending = false;
+		pending = Request();
+	}
+
+	condition.notify_one();
+	worker.join();
+}
+
+unsigned int LinkFeasibilityChecker::request(const RefPtr<Element>& src_parent, const RefPtr<Object>& src_model,
+		const RefPtr<Element>& sink_parent, const RefPtr<Object>& sink_model)
+{
+	unsigned int id = ++latest_id;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		pending = {id, src_parent, src_model, sink_parent, sink_model};
+		has_pending = true;
+	}
+
+	condition.notify_one();
+
+	return id;
+}
+
+void LinkFeasibilityChecker::cancel()
+{
+	++latest_id;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	has_pending = false;
+	pending = Request();
+}
+
+void LinkFeasibilityChecker::run()
+{
+	while (true)
+	{
+		Request current;
+
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [this] { return has_pending || stopped; });
+
+			if (stopped)
+				return;
+
+			current = pending;
+			pending = Request();
+			has_pending = false;
+		}
+
+		if (!is_latest(current.id))
+			continue;
+
+		bool result = QNEPort::can_link(current.src_parent, current.src_model,
+				current.sink_parent, current.sink_model);
+
+		// emitted from the worker thread, so receivers in the GUI thread get it queued
+		if (is_latest(current.id))
+			Q_EMIT link_checked(current.id, result);
+	}
+}
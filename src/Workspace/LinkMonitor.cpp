@@ -0,0 +1,129 @@
+/*
+ * LinkMonitor.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "LinkMonitor.h"
+
+LinkMonitor::~LinkMonitor()
+{
+	detach_all();
+}
+
+GstPadProbeReturn LinkMonitor::probe_callback(GstPad* pad, GstPadProbeInfo* info, gpointer user_data)
+{
+	Counters* counters = static_cast<std::shared_ptr<Counters>*>(user_data)->get();
+
+	if (info->type & GST_PAD_PROBE_TYPE_BUFFER)
+	{
+		GstBuffer* buffer = GST_PAD_PROBE_INFO_BUFFER(info);
+		counters->buffers.fetch_add(1, std::memory_order_relaxed);
+		counters->bytes.fetch_add(gst_buffer_get_size(buffer), std::memory_order_relaxed);
+		if (GST_BUFFER_PTS_IS_VALID(buffer))
+			counters->last_pts.store(GST_BUFFER_PTS(buffer), std::memory_order_relaxed);
+	}
+	else if (info->type & GST_PAD_PROBE_TYPE_BUFFER_LIST)
+	{
+		GstBufferList* list = GST_PAD_PROBE_INFO_BUFFER_LIST(info);
+		guint length = gst_buffer_list_length(list);
+		guint64 bytes = 0;
+
+		for (guint i = 0; i < length; i++)
+		{
+			GstBuffer* buffer = gst_buffer_list_get(list, i);
+			bytes += gst_buffer_get_size(buffer);
+			if (GST_BUFFER_PTS_IS_VALID(buffer))
+				counters->last_pts.store(GST_BUFFER_PTS(buffer), std::memory_order_relaxed);
+		}
+
+		counters->buffers.fetch_add(length, std::memory_order_relaxed);
+		counters->bytes.fetch_add(bytes, std::memory_order_relaxed);
+	}
+
+	return GST_PAD_PROBE_OK;
+}
+
+void LinkMonitor::destroy_counters(gpointer user_data)
+{
+	delete static_cast<std::shared_ptr<Counters>*>(user_data);
+}
+
+void LinkMonitor::attach(GstPad* src_pad)
+{
+	if (is_attached(src_pad))
+		return;
+
+	Link link;
+	link.counters = std::make_shared<Counters>();
+	link.sampled_buffers = 0;
+	link.sampled_bytes = 0;
+	link.sampled_time = g_get_monotonic_time();
+
+	// the probe keeps its own reference, so counters outlive a probe call racing with detach()
+	link.probe_id = gst_pad_add_probe(src_pad,
+			static_cast<GstPadProbeType>(GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_BUFFER_LIST),
+			probe_callback, new std::shared_ptr<Counters>(link.counters), destroy_counters);
+
+	if (link.probe_id == 0)
+		return;
+
+	gst_object_ref(src_pad);
+	links[src_pad] = link;
+}
+
+void LinkMonitor::detach(GstPad* src_pad)
+{
+	auto it = links.find(src_pad);
+
+	if (it == links.end())
+		return;
+
+	gst_pad_remove_probe(src_pad, it->second.probe_id);
+	links.erase(it);
+	gst_object_unref(src_pad);
+}
+
+void LinkMonitor::detach_all()
+{
+	while (!links.empty())
+		detach(links.begin()->first);
+}
+
+bool LinkMonitor::sample(GstPad* src_pad, Sample& sample)
+{
+	auto it = links.find(src_pad);
+
+	if (it == links.end())
+		return false;
+
+	Link& link = it->second;
+	guint64 buffers = link.counters->buffers.load(std::memory_order_relaxed);
+	guint64 bytes = link.counters->bytes.load(std::memory_order_relaxed);
+	gint64 now = g_get_monotonic_time();
+	double seconds = (now - link.sampled_time) / double(G_USEC_PER_SEC);
+
+	if (seconds <= 0)
+		return false;
+
+	sample.buffers_per_second = (buffers - link.sampled_buffers) / seconds;
+	sample.bytes_per_second = (bytes - link.sampled_bytes) / seconds;
+	sample.last_pts = link.counters->last_pts.load(std::memory_order_relaxed);
+
+	link.sampled_buffers = buffers;
+	link.sampled_bytes = bytes;
+	link.sampled_time = now;
+
+	return true;
+}
+
+std::vector<GstPad*> LinkMonitor::get_pads() const
+{
+	std::vector<GstPad*> pads;
+
+	for (const auto& link : links)
+		pads.push_back(link.first);
+
+	return pads;
+}
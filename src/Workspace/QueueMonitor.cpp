@@ -0,0 +1,144 @@
+/*
+ * QueueMonitor.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "QueueMonitor.h"
+#include <algorithm>
+#include <cstring>
+
+QueueMonitor::~QueueMonitor()
+{
+	detach_all();
+}
+
+void QueueMonitor::overrun_callback(GstElement* element, gpointer user_data)
+{
+	(*static_cast<std::shared_ptr<Counters>*>(user_data))->overruns.fetch_add(1, std::memory_order_relaxed);
+}
+
+void QueueMonitor::underrun_callback(GstElement* element, gpointer user_data)
+{
+	(*static_cast<std::shared_ptr<Counters>*>(user_data))->underruns.fetch_add(1, std::memory_order_relaxed);
+}
+
+void QueueMonitor::destroy_counters(gpointer user_data, GClosure* closure)
+{
+	delete static_cast<std::shared_ptr<Counters>*>(user_data);
+}
+
+void QueueMonitor::connect_signal(GstElement* element, const char* signal, GCallback callback, Queue& queue)
+{
+	if (g_signal_lookup(signal, G_OBJECT_TYPE(element)) == 0)
+		return;
+
+	queue.handlers.push_back(g_signal_connect_data(element, signal, callback,
+			new std::shared_ptr<Counters>(queue.counters), destroy_counters, static_cast<GConnectFlags>(0)));
+}
+
+bool QueueMonitor::attach(GstElement* element)
+{
+	if (queues.count(element))
+		return true;
+
+	GstElementFactory* factory = gst_element_get_factory(element);
+
+	if (factory == nullptr)
+		return false;
+
+	const gchar* name = gst_plugin_feature_get_name(GST_PLUGIN_FEATURE(factory));
+	bool is_multiqueue = !strcmp(name, "multiqueue");
+
+	if (strcmp(name, "queue") && strcmp(name, "queue2") && !is_multiqueue)
+		return false;
+
+	Queue queue;
+	queue.counters = std::make_shared<Counters>();
+	// multiqueue keeps levels per pad and doesn't expose them as properties
+	queue.has_level = !is_multiqueue;
+
+	connect_signal(element, "overrun", G_CALLBACK(overrun_callback), queue);
+	connect_signal(element, "underrun", G_CALLBACK(underrun_callback), queue);
+
+	gst_object_ref(element);
+	queues[element] = queue;
+
+	return true;
+}
+
+void QueueMonitor::detach(GstElement* element)
+{
+	auto it = queues.find(element);
+
+	if (it == queues.end())
+		return;
+
+	for (auto handler : it->second.handlers)
+		g_signal_handler_disconnect(element, handler);
+
+	queues.erase(it);
+	gst_object_unref(element);
+}
+
+void QueueMonitor::detach_all()
+{
+	while (!queues.empty())
+		detach(queues.begin()->first);
+}
+
+bool QueueMonitor::get_status(GstElement* element, Status& status) const
+{
+	auto it = queues.find(element);
+
+	if (it == queues.end())
+		return false;
+
+	status.overruns = it->second.counters->overruns.load(std::memory_order_relaxed);
+	status.underruns = it->second.counters->underruns.load(std::memory_order_relaxed);
+	status.has_level = it->second.has_level;
+	status.level = 0;
+	status.current_buffers = 0;
+	status.current_bytes = 0;
+	status.current_time = 0;
+
+	if (!status.has_level)
+		return true;
+
+	guint current_bytes = 0, max_buffers = 0, max_bytes = 0;
+	guint64 max_time = 0;
+
+	g_object_get(element,
+			"current-level-buffers", &status.current_buffers,
+			"current-level-bytes", &current_bytes,
+			"current-level-time", &status.current_time,
+			"max-size-buffers", &max_buffers,
+			"max-size-bytes", &max_bytes,
+			"max-size-time", &max_time,
+			NULL);
+
+	status.current_bytes = current_bytes;
+
+	// the queue is full when any of its enabled limits is reached
+	if (max_buffers)
+		status.level = std::max(status.level, double(status.current_buffers) / max_buffers);
+	if (max_bytes)
+		status.level = std::max(status.level, double(current_bytes) / max_bytes);
+	if (max_time)
+		status.level = std::max(status.level, double(status.current_time) / max_time);
+
+	status.level = std::min(status.level, 1.0);
+
+	return true;
+}
+
+std::vector<GstElement*> QueueMonitor::get_elements() const
+{
+	std::vector<GstElement*> elements;
+
+	for (const auto& queue : queues)
+		elements.push_back(queue.first);
+
+	return elements;
+}
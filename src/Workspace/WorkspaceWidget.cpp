@@ -8,8 +8,12 @@
 #include "WorkspaceWidget.h"
 #include "common.h"
 #include "utils/GstUtils.h"
+#include "utils/LinkMatrix.h"
+#include "utils/AutoPlugPathFinder.h"
 #include <QtGui>
 #include <QFrame>
+#include <limits>
+#include <cmath>
 
 using namespace Gst;
 using Glib::RefPtr;
@@ -18,14 +22,45 @@ WorkspaceWidget::WorkspaceWidget(const RefPtr<Pipeline>& model, QWidget* parent)
 : QWidget(parent),
   controller(nullptr),
   current_connection(nullptr),
-  model(model)
+  hovered_port(nullptr),
+  hovered_link_status(2),
+  hovered_request(0),
+  model(model),
+  bulk_update_depth(0),
+  layout_request(0),
+  has_drop_position(false),
+  detailed_view(true),
+  playing(false)
 {
 	setAcceptDrops(true);
 	scene = new QGraphicsScene();
 	scene->installEventFilter(this);
 	view = new QGraphicsView(scene, this);
 	view->setRenderHint(QPainter::Antialiasing, true);
+	view->setTransformationAnchor(QGraphicsView::AnchorUnderMouse);
 	this->installEventFilter(this);
+
+	link_checker = new LinkFeasibilityChecker(this);
+	QObject::connect(link_checker, &LinkFeasibilityChecker::link_checked, this, &WorkspaceWidget::link_checked);
+
+	layout_engine = new GraphLayout(this);
+	QObject::connect(layout_engine, &GraphLayout::layout_finished, this, &WorkspaceWidget::layout_finished);
+
+	// adding many elements one by one results in a single layout run
+	layout_timer = new QTimer(this);
+	layout_timer->setSingleShot(true);
+	layout_timer->setInterval(50);
+	QObject::connect(layout_timer, &QTimer::timeout, this, &WorkspaceWidget::request_layout);
+
+	monitor_timer = new QTimer(this);
+	monitor_timer->setInterval(500);
+	QObject::connect(monitor_timer, &QTimer::timeout, this, &WorkspaceWidget::update_link_statistics);
+	QObject::connect(monitor_timer, &QTimer::timeout, this, &WorkspaceWidget::update_element_profile);
+
+	queue_timer = new QTimer(this);
+	queue_timer->setInterval(1000);
+	QObject::connect(queue_timer, &QTimer::timeout, this, &WorkspaceWidget::update_queue_levels);
+
 	CommandListener::refcount++;
 }
 
@@ -65,7 +100,7 @@ QGraphicsItem* WorkspaceWidget::item_at(const QPointF &pos)
 
 	return nullptr;
 }
-QPointF last_point; // fixme
+
 bool WorkspaceWidget::eventFilter(QObject *o, QEvent *e)
 {
 	QGraphicsSceneMouseEvent *me = (QGraphicsSceneMouseEvent*) e;
@@ -85,6 +120,7 @@ bool WorkspaceWidget::eventFilter(QObject *o, QEvent *e)
 			if (item->type() == QNEPort::Type)
 			{
 				current_connection = new QNEConnection(0);
+				hovered_port = nullptr;
 				scene->addItem(current_connection);
 				current_connection->setPort1((QNEPort*) item);
 				current_connection->setPos1(item->scenePos());
@@ -93,7 +129,11 @@ bool WorkspaceWidget::eventFilter(QObject *o, QEvent *e)
 				return true;
 			}
 			else if (item->type() == QNEBlock::Type)
+			{
+				// a block touched by the user is not moved by the automatic layout anymore
+				auto_placed_blocks.erase(static_cast<QNEBlock*>(item));
 				Q_EMIT current_element_changed(static_cast<QNEBlock*>(item)->get_model());
+			}
 
 			break;
 		}
@@ -107,20 +147,28 @@ bool WorkspaceWidget::eventFilter(QObject *o, QEvent *e)
 				QNEPort* src_port = con->port1()->isOutput() ? con->port1() : con->port2();
 				QNEPort* sink_port = con->port1()->isOutput() ? con->port2() : con->port1();
 
-				DisconnectCommand cmd(src_port->get_object_model(), sink_port->get_object_model());
-				cmd.run_command({controller, this});
+				execute(new DisconnectCommand(src_port->get_object_model(), sink_port->get_object_model()));
 			}
 			else if (item && (item->type() == QNEBlock::Type))
 			{
 				QNEBlock* block = static_cast<QNEBlock*>(item);
-				RemoveCommand cmd(ObjectType::ELEMENT, block->get_model());
-				cmd.run_command({controller, this});
+				execute(new RemoveCommand(ObjectType::ELEMENT, block->get_model()));
 			}
 			break;
 		}
 		}
 		break;
 	}
+	case QEvent::GraphicsSceneWheel:
+	{
+		QGraphicsSceneWheelEvent* we = static_cast<QGraphicsSceneWheelEvent*>(e);
+
+		if (!(we->modifiers() & Qt::ControlModifier))
+			break;
+
+		zoom(we->delta());
+		return true;
+	}
 	case QEvent::GraphicsSceneMouseMove:
 	{
 		if (!current_connection)
@@ -131,13 +179,36 @@ bool WorkspaceWidget::eventFilter(QObject *o, QEvent *e)
 		QGraphicsItem *item = item_at(me->scenePos());
 		if (item && item != current_connection->port1() && item->type() == QNEPort::Type)
 		{
-			QNEPort *src_port = (current_connection->port1()->isOutput()) ? current_connection->port1() : (QNEPort*) item;
-			QNEPort *sink_port = (!current_connection->port1()->isOutput()) ? current_connection->port1() : (QNEPort*) item;
+			if (item != hovered_port)
+			{
+				QNEPort *src_port = (current_connection->port1()->isOutput()) ? current_connection->port1() : (QNEPort*) item;
+				QNEPort *sink_port = (!current_connection->port1()->isOutput()) ? current_connection->port1() : (QNEPort*) item;
 
-			current_connection->connectColor(src_port->can_link(sink_port));
+				hovered_port = (QNEPort*) item;
+
+				if (src_port->isOutput() == sink_port->isOutput())
+				{
+					link_checker->cancel();
+					hovered_link_status = 0;
+				}
+				else
+				{
+					// the colour is updated in link_checked() once the worker is done
+					hovered_link_status = 2;
+					hovered_request = link_checker->request(src_port->block()->get_model(), src_port->get_object_model(),
+							sink_port->block()->get_model(), sink_port->get_object_model());
+				}
+			}
+
+			current_connection->connectColor(hovered_link_status);
 		}
 		else
+		{
+			if (hovered_port)
+				link_checker->cancel();
+			hovered_port = nullptr;
 			current_connection->connectColor(2);
+		}
 
 		return true;
 	}
@@ -157,6 +228,9 @@ bool WorkspaceWidget::eventFilter(QObject *o, QEvent *e)
 		if (!current_connection || me->button() != Qt::LeftButton)
 			break;
 
+		link_checker->cancel();
+		hovered_port = nullptr;
+
 		QGraphicsItem *item = item_at(me->scenePos());
 		if (item && item->type() == QNEPort::Type)
 		{
@@ -167,7 +241,11 @@ bool WorkspaceWidget::eventFilter(QObject *o, QEvent *e)
 			current_connection = 0;
 
 			if (!src_port->can_link(sink_port))
+			{
+				if (src_port->isOutput() && !sink_port->isOutput() && src_port->block() != sink_port->block())
+					auto_plug(src_port, sink_port);
 				return true;
+			}
 
 			if (src_port->block() != sink_port->block() && src_port->isOutput() != sink_port->isOutput() && !src_port->isConnected(sink_port))
 			{
@@ -179,18 +257,17 @@ bool WorkspaceWidget::eventFilter(QObject *o, QEvent *e)
 					else if (!src_port->get_object_model() && sink_port->get_object_model())
 					{
 						lnk = GstUtils::find_connection(Glib::RefPtr<Gst::Object>::cast_static(src_port->block()->get_model()), sink_port->get_object_model());
-						if (GST_IS_PAD_TEMPLATE(sink_port->get_object_model()->gobj())) // todo it should be done in find_connection method!
-						{
-							lnk.sink = sink_port->get_object_model();
+						if (GST_IS_PAD_TEMPLATE(sink_port->get_object_model()->gobj()))
 							lnk.sink_parent = sink_port->block()->get_model();
-						}
 					}
 					else
+					{
 						lnk = GstUtils::find_connection(src_port->get_object_model(), Glib::RefPtr<Gst::Object>::cast_static(sink_port->block()->get_model()));
+						if (GST_IS_PAD_TEMPLATE(src_port->get_object_model()->gobj()))
+							lnk.src_parent = src_port->block()->get_model();
+					}
 
-					ConnectCommand* cmd = ConnectCommand::from_linkage(lnk, {controller, this});
-					cmd->run_command({controller, this});
-					delete cmd;
+					execute(ConnectCommand::from_linkage(lnk, {controller, this}));
 					return true;
 				}
 
@@ -199,25 +276,27 @@ bool WorkspaceWidget::eventFilter(QObject *o, QEvent *e)
 				if (src_port->is_template_model() && RefPtr<PadTemplate>::cast_static(src_port->get_object_model())->get_presence() == PAD_REQUEST)
 				{
 					auto tpl = RefPtr<PadTemplate>::cast_static(src_port->get_object_model());
-					AddCommand add_cmd(ObjectType::PAD, src_port->block()->get_model(), tpl);
-					src_pad = src_pad.cast_static(add_cmd.run_command_ret({controller, this}));
+					std::shared_ptr<AddCommand> add_cmd(new AddCommand(ObjectType::PAD, src_port->block()->get_model(), tpl));
+					src_pad = src_pad.cast_static(add_cmd->run_command_ret({controller, this}));
+					if (controller)
+						controller->command_executed(add_cmd);
 				}
 				else if (sink_port->is_template_model() && RefPtr<PadTemplate>::cast_static(sink_port->get_object_model())->get_presence() == PAD_REQUEST)
 				{
 					auto tpl = RefPtr<PadTemplate>::cast_static(sink_port->get_object_model());
-					AddCommand add_cmd(ObjectType::PAD, sink_port->block()->get_model(), tpl);
-					sink_pad = sink_pad.cast_static(add_cmd.run_command_ret({controller, this}));
+					std::shared_ptr<AddCommand> add_cmd(new AddCommand(ObjectType::PAD, sink_port->block()->get_model(), tpl));
+					sink_pad = sink_pad.cast_static(add_cmd->run_command_ret({controller, this}));
+					if (controller)
+						controller->command_executed(add_cmd);
 				}
 				if (src_port->is_template_model() && RefPtr<PadTemplate>::cast_static(src_port->get_object_model())->get_presence() == PAD_SOMETIMES)
 				{
 					auto pad_parent = src_port->block()->get_model();
 					auto tpl = RefPtr<PadTemplate>::cast_static(src_port->get_object_model());
-					ConnectCommand con_cmd(tpl, pad_parent, sink_pad);
-					con_cmd.run_command({controller, this});
+					execute(new ConnectCommand(tpl, pad_parent, sink_pad));
 					return true;
 				}
-				ConnectCommand cmd(src_pad, sink_pad);
-				cmd.run_command({controller, this});
+				execute(new ConnectCommand(src_pad, sink_pad));
 
 
 				return true;
@@ -249,14 +328,15 @@ bool WorkspaceWidget::eventFilter(QObject *o, QEvent *e)
 			return true;
 
 		element->set_name(name.toUtf8().constData());
-		last_point = me->scenePos();
-		AddCommand cmd(ObjectType::ELEMENT, model, element);
+		has_drop_position = true;
+		drop_position = me->scenePos();
 		try
 		{
-			cmd.run_command({controller, this});
+			execute(new AddCommand(ObjectType::ELEMENT, model, element));
 		}
 		catch (const std::exception& ex)
 		{
+			has_drop_position = false;
 			QMessageBox message_box;
 			message_box.critical(0,"Error", QString("Cannot add element: ") + ex.what());
 		}
@@ -266,24 +346,148 @@ bool WorkspaceWidget::eventFilter(QObject *o, QEvent *e)
 	return QObject::eventFilter(o, e);
 }
 
+void WorkspaceWidget::link_checked(unsigned int request, int status)
+{
+	if (request != hovered_request || !link_checker->is_latest(request) || !hovered_port || !current_connection)
+		return;
+
+	hovered_link_status = status;
+	current_connection->connectColor(status);
+}
+
+void WorkspaceWidget::execute(Command* command)
+{
+	std::shared_ptr<Command> cmd(command);
+
+	if (!cmd)
+		return;
+
+	cmd->run_command({controller, this});
+
+	if (controller)
+		controller->command_executed(cmd);
+}
+
+Command* WorkspaceWidget::create_link_command(const RefPtr<Object>& src, const RefPtr<Element>& src_parent,
+		const RefPtr<Object>& sink, const RefPtr<Element>& sink_parent)
+{
+	Linkage lnk = GstUtils::find_connection(src, sink);
+
+	if (!lnk.exists)
+		throw std::runtime_error("cannot link " + GstUtils::generate_element_path(src, model) +
+				" with " + GstUtils::generate_element_path(sink, model));
+
+	if (!lnk.src_parent)
+		lnk.src_parent = src_parent;
+	if (!lnk.sink_parent)
+		lnk.sink_parent = sink_parent;
+
+	return ConnectCommand::from_linkage(lnk, {controller, this});
+}
+
+void WorkspaceWidget::auto_plug(QNEPort* src_port, QNEPort* sink_port)
+{
+	auto matrix = LinkMatrix::get();
+
+	if (!matrix)
+		return;
+
+	RefPtr<Element> source = src_port->block()->get_model();
+	RefPtr<Element> destination = sink_port->block()->get_model();
+	std::vector<std::string> path;
+
+	if (!AutoPlugPathFinder(matrix).find_path(source, src_port->get_object_model(),
+			destination, sink_port->get_object_model(), path))
+		return;
+
+	QStringList names;
+	for (auto name : path)
+		names << name.c_str();
+
+	if (QMessageBox::question(this, "Auto-plug", "These pads cannot be linked directly. Insert " +
+			names.join(" ! ") + " between them?", QMessageBox::Yes | QMessageBox::No) != QMessageBox::Yes)
+		return;
+
+	try
+	{
+		QPointF src_pos = src_port->block()->pos(), sink_pos = sink_port->block()->pos();
+		RefPtr<Object> src = src_port->get_object_model() ? src_port->get_object_model() : RefPtr<Object>::cast_static(source);
+		RefPtr<Object> sink = sink_port->get_object_model() ? sink_port->get_object_model() : RefPtr<Object>::cast_static(destination);
+		RefPtr<Element> src_parent = source;
+		std::vector<RefPtr<Element>> elements;
+
+		// the whole chain is a single batch, so it can be undone in one step
+		BatchCommand* batch = new BatchCommand();
+
+		for (size_t i = 0; i < path.size(); i++)
+		{
+			RefPtr<Element> element = ElementFactory::create_element(path[i]);
+
+			if (!element)
+			{
+				delete batch;
+				throw std::runtime_error("cannot create element " + path[i]);
+			}
+
+			batch->add_command(new AddCommand(ObjectType::ELEMENT, model, element));
+			batch->add_command([this, src, src_parent, element] {
+				return create_link_command(src, src_parent, element, element);
+			});
+
+			elements.push_back(element);
+			src = element;
+			src_parent = element;
+		}
+
+		batch->add_command([this, src, src_parent, sink, destination] {
+			return create_link_command(src, src_parent, sink, destination);
+		});
+
+		execute(batch);
+
+		for (size_t i = 0; i < elements.size(); i++)
+		{
+			QPointF pos = src_pos + (sink_pos - src_pos) * (i + 1) / (path.size() + 1);
+			set_block_location(elements[i], pos.x(), pos.y());
+		}
+	}
+	catch (const std::exception& ex)
+	{
+		QMessageBox message_box;
+		message_box.critical(0, "Error", QString("Cannot auto-plug elements: ") + ex.what());
+	}
+}
+
 void WorkspaceWidget::new_element_added(const RefPtr<Element>& element)
 {
 	QNEBlock *b = new QNEBlock(element, 0);
 	scene->addItem(b);
+	blocks[element->gobj()] = b;
+
+	if (bulk_update_depth > 0)
+	{
+		b->setLayoutDeferred(true);
+		deferred_blocks.insert(b);
+	}
+
 	b->addPort(element, 0, QNEPort::NamePort);
-	if (!GstUtils::is_src_element(element))
-		b->addInputPort(RefPtr<Object>());
-	if (!GstUtils::is_sink_element(element))
-		b->addOutputPort(RefPtr<Object>());
+
+	auto matrix = LinkMatrix::get();
+	int factory = matrix ? matrix->find_factory(element) : -1;
+
+	if (factory >= 0 ? matrix->has_upstream(factory) : !GstUtils::is_src_element(element))
+		add_port(b, RefPtr<Object>(), false);
+	if (factory >= 0 ? matrix->has_downstream(factory) : !GstUtils::is_sink_element(element))
+		add_port(b, RefPtr<Object>(), true);
 
 	auto pad_iterator = element->iterate_pads();
 
 	while (pad_iterator.next())
 	{
 		if (pad_iterator->get_direction() == PAD_SINK)
-			b->addInputPort(*pad_iterator);
+			add_port(b, *pad_iterator, false);
 		else if (pad_iterator->get_direction() == PAD_SRC)
-			b->addOutputPort(*pad_iterator);
+			add_port(b, *pad_iterator, true);
 	}
 
 	std::vector<StaticPadTemplate> templates = element->get_factory()->get_static_pad_templates();
@@ -291,64 +495,130 @@ void WorkspaceWidget::new_element_added(const RefPtr<Element>& element)
 	for (auto tpl : templates)
 	{
 		if (tpl.get_presence() == PAD_SOMETIMES || tpl.get_presence() == PAD_REQUEST)
-			b->addPort(element->get_pad_template(tpl.get_name_template()), tpl.get_direction() == PAD_SRC);
+			add_port(b, element->get_pad_template(tpl.get_name_template()), tpl.get_direction() == PAD_SRC);
 	}
 
-	b->setPos(last_point);
+	if (queue_timer->isActive())
+		queue_monitor.attach(element->gobj());
+
+	if (has_drop_position)
+	{
+		b->setPos(drop_position);
+		has_drop_position = false;
+	}
+	else
+	{
+		auto_placed_blocks.insert(b);
+		schedule_layout();
+	}
 }
 
 void WorkspaceWidget::element_removed(const RefPtr<Element>& element)
 {
-	QNEBlock *b = find_block(element);
-	delete b;
+	auto it = blocks.find(element->gobj());
+
+	element_profiler.detach(element->gobj());
+	queue_monitor.detach(element->gobj());
+	queue_status.erase(element->gobj());
+
+	if (it != blocks.end())
+	{
+		QNEBlock *b = it->second;
+		blocks.erase(it);
+		deferred_blocks.erase(b);
+		if (auto_placed_blocks.erase(b))
+			schedule_layout();
+
+		for (auto port : b->ports())
+			unregister_port(port);
+		delete b;
+	}
 
 	Q_EMIT current_element_changed(RefPtr<Element>());
 }
 
+QNEPort* WorkspaceWidget::add_port(QNEBlock* block, const RefPtr<Object>& model, bool is_output)
+{
+	QNEPort* port = block->addPort(model, is_output);
+
+	if (!detailed_view)
+		port->setLabelVisible(false);
+
+	if (!model)
+		return port;
+
+	if (GST_IS_PAD(model->gobj()))
+		pad_ports[GST_PAD(model->gobj())] = port;
+	else if (GST_IS_PAD_TEMPLATE(model->gobj()))
+		template_ports[template_key(block->get_model()->gobj(), GST_PAD_TEMPLATE(model->gobj()))] = port;
+
+	return port;
+}
+
+void WorkspaceWidget::unregister_port(QNEPort* port)
+{
+	RefPtr<Object> model = port->get_object_model();
+
+	if (!model)
+		return;
+
+	if (GST_IS_PAD(model->gobj()))
+	{
+		link_monitor.detach(GST_PAD(model->gobj()));
+		element_profiler.detach_pad(GST_PAD(model->gobj()));
+		pad_ports.erase(GST_PAD(model->gobj()));
+	}
+	else if (GST_IS_PAD_TEMPLATE(model->gobj()))
+		template_ports.erase(template_key(port->block()->get_model()->gobj(), GST_PAD_TEMPLATE(model->gobj())));
+}
+
 QNEPort* WorkspaceWidget::find_port(const RefPtr<Pad>& pad)
 {
-	QNEBlock* block = find_block(pad->get_parent_element());
-	return (!block) ? nullptr : block->find_port(pad);
+	if (!pad)
+		return nullptr;
+
+	auto it = pad_ports.find(pad->gobj());
+	return (it == pad_ports.end()) ? nullptr : it->second;
 }
 
 QNEPort* WorkspaceWidget::find_port(const RefPtr<PadTemplate>& pad_template, const RefPtr<Element>& parent)
 {
-	QNEBlock* block = find_block(parent);
-	return (!block) ? nullptr : block->find_port(pad_template);
+	if (!pad_template || !parent)
+		return nullptr;
+
+	auto it = template_ports.find(template_key(parent->gobj(), pad_template->gobj()));
+	return (it == template_ports.end()) ? nullptr : it->second;
 }
 
 QNEBlock* WorkspaceWidget::find_block(const RefPtr<Element>& element)
 {
-	for (auto item : scene->items())
-	{
-		if (!item || item->type() != QNEBlock::Type)
-			continue;
-
-		QNEBlock* block = static_cast<QNEBlock*>(item);
+	if (!element)
+		return nullptr;
 
-		if (block && block->get_model() == element)
-			return block;
-	}
-
-	return nullptr;
+	auto it = blocks.find(element->gobj());
+	return (it == blocks.end()) ? nullptr : it->second;
 }
 
 void WorkspaceWidget::pad_added(const RefPtr<Pad>& pad)
 {
 	QNEBlock* block = find_block(pad->get_parent_element());
 
-	if (block == nullptr)
+	if (block == nullptr || find_port(pad) != nullptr)
 		return;
 
 	if (pad->get_direction() == PAD_SINK)
-		block->addInputPort(pad);
+		add_port(block, pad, false);
 	else if (pad->get_direction() == PAD_SRC)
-		block->addOutputPort(pad);
+		add_port(block, pad, true);
+
+	if (playing)
+		element_profiler.attach_pad(pad->gobj());
 }
 
 void WorkspaceWidget::pad_linked(const RefPtr<Pad>& pad)
 {
-	if (pad->get_direction() == PAD_SINK)
+	// the pad may have been unlinked again before the event was delivered
+	if (pad->get_direction() == PAD_SINK || !pad->is_linked())
 		return;
 
 	QNEPort* first_port = find_port(pad->get_peer()),
@@ -363,12 +633,22 @@ void WorkspaceWidget::pad_linked(const RefPtr<Pad>& pad)
 	connection->setPort2(second_port);
 	connection->setPos1(first_port->scenePos());
 	connection->setPort1(first_port);
-	connection->updatePath();
+
+	if (bulk_update_depth == 0)
+		connection->updatePath();
+
+	if (playing)
+		link_monitor.attach(pad->gobj());
 }
 
 void WorkspaceWidget::pad_removed(const RefPtr<Pad>& pad)
 {
 	QNEPort* port = find_port(pad);
+
+	if (port == nullptr)
+		return;
+
+	unregister_port(port);
 	delete port;
 }
 
@@ -377,21 +657,18 @@ void WorkspaceWidget::pad_unlinked(const RefPtr<Pad>& pad)
 	if (pad->get_direction() == PAD_SINK)
 		return;
 
+	link_monitor.detach(pad->gobj());
+
 	QNEPort* port = find_port(pad);
 
 	if (port == nullptr)
 		return;
 
-	for (auto item : scene->items())
+	for (auto con : port->connections())
 	{
-		if (!item || item->type() != QNEConnection::Type)
-			continue;
-
-		QNEConnection* con = static_cast<QNEConnection*>(item);
-
-		if (con->port1() && con->port2()->get_object_model() == port->get_object_model())
+		if (con->port1() && con->port2())
 		{
-			delete item;
+			delete con;
 			break;
 		}
 	}
@@ -412,7 +689,9 @@ void WorkspaceWidget::future_connection_added(const RefPtr<PadTemplate>& src_tpl
 	connection->setPos1(src_port->scenePos());
 	connection->setPort2(sink_port);
 	connection->setPos2(sink_port->scenePos());
-	connection->updatePath();
+
+	if (bulk_update_depth == 0)
+		connection->updatePath();
 }
 
 void WorkspaceWidget::future_connection_removed(const ConnectCommand::future_connection_pads& conn)
@@ -423,17 +702,11 @@ void WorkspaceWidget::future_connection_removed(const ConnectCommand::future_con
 	if (!src_port || !sink_port)
 		return;
 
-	for (auto item : scene->items())
+	for (auto con : src_port->connections())
 	{
-		if (!item || item->type() != QNEConnection::Type)
-			continue;
-
-		QNEConnection* con = static_cast<QNEConnection*>(item);
-		if (con->port1() && con->port2() &&
-				(con->port1()->get_object_model() == src_port->get_object_model() &&
-						con->port2()->get_object_model() == sink_port->get_object_model()))
+		if (con->port1() == src_port && con->port2() == sink_port)
 		{
-			delete item;
+			delete con;
 			break;
 		}
 	}
@@ -456,9 +729,320 @@ void WorkspaceWidget::set_block_location(const Glib::RefPtr<Gst::Element>& eleme
 	if (block == nullptr)
 		return;
 
+	auto_placed_blocks.erase(block);
 	block->setPos(x, y);
 }
 
+void WorkspaceWidget::bulk_update_started()
+{
+	if (bulk_update_depth++ > 0)
+		return;
+
+	scene->setItemIndexMethod(QGraphicsScene::NoIndex);
+	view->setUpdatesEnabled(false);
+}
+
+void WorkspaceWidget::bulk_update_finished()
+{
+	if (--bulk_update_depth > 0)
+		return;
+
+	for (auto block : deferred_blocks)
+		block->setLayoutDeferred(false);
+	deferred_blocks.clear();
+
+	for (auto item : scene->items())
+	{
+		if (item->type() != QNEConnection::Type)
+			continue;
+
+		QNEConnection* connection = static_cast<QNEConnection*>(item);
+
+		if (connection->port1() && connection->port2())
+		{
+			connection->updatePosFromPorts();
+			connection->updatePath();
+		}
+	}
+
+	scene->setItemIndexMethod(QGraphicsScene::BspTreeIndex);
+	view->setUpdatesEnabled(true);
+	view->viewport()->update();
+
+	schedule_layout();
+}
+
+void WorkspaceWidget::state_changed(State state)
+{
+	playing = (state == State::PLAY);
+
+	// queues are worth watching in PAUSED too, e.g. when a branch doesn't preroll
+	if (state != State::STOP)
+	{
+		for (auto block : blocks)
+			queue_monitor.attach(block.first);
+
+		queue_timer->start();
+	}
+	else
+	{
+		queue_timer->stop();
+
+		for (auto element : queue_monitor.get_elements())
+		{
+			auto it = blocks.find(element);
+			if (it != blocks.end())
+				it->second->setFillLevel(-1);
+		}
+
+		queue_monitor.detach_all();
+		queue_status.clear();
+	}
+
+	if (playing)
+	{
+		for (auto port : pad_ports)
+			if (GST_PAD_IS_SRC(port.first) && gst_pad_is_linked(port.first))
+				link_monitor.attach(port.first);
+
+		for (auto block : blocks)
+			element_profiler.attach(block.first);
+
+		monitor_timer->start();
+		return;
+	}
+
+	monitor_timer->stop();
+
+	for (auto pad : link_monitor.get_pads())
+	{
+		auto it = pad_ports.find(pad);
+
+		if (it != pad_ports.end())
+			for (auto con : it->second->connections())
+				con->setInfo(QString());
+	}
+
+	link_monitor.detach_all();
+
+	element_profiler.detach_all();
+
+	for (auto block : blocks)
+	{
+		block.second->setHeat(-1);
+		update_block_tooltip(block.second);
+	}
+}
+
+void WorkspaceWidget::update_block_tooltip(QNEBlock* block)
+{
+	GstElement* element = block->get_model()->gobj();
+	QStringList lines;
+	ElementProfiler::Percentiles p;
+
+	if (element_profiler.get_percentiles(element, p))
+		lines << QString("p50: %1 us").arg(p.p50 / 1000.0, 0, 'f', 1)
+				<< QString("p99: %1 us").arg(p.p99 / 1000.0, 0, 'f', 1)
+				<< QString("buffers: %1").arg(p.count);
+
+	auto it = queue_status.find(element);
+
+	if (it != queue_status.end())
+	{
+		const QueueMonitor::Status& status = it->second;
+
+		if (status.has_level)
+			lines << QString("level: %1% (%2 buffers, %3 bytes, %4 ms)").arg(status.level * 100, 0, 'f', 0)
+					.arg(status.current_buffers).arg(status.current_bytes).arg(status.current_time / GST_MSECOND);
+
+		lines << QString("overruns: %1, underruns: %2").arg(status.overruns).arg(status.underruns);
+	}
+
+	block->setToolTip(lines.join("\n"));
+}
+
+static QString format_rate(double bytes_per_second)
+{
+	if (bytes_per_second >= 1024 * 1024)
+		return QString::number(bytes_per_second / (1024 * 1024), 'f', 1) + " MB/s";
+	if (bytes_per_second >= 1024)
+		return QString::number(bytes_per_second / 1024, 'f', 1) + " kB/s";
+	return QString::number(bytes_per_second, 'f', 0) + " B/s";
+}
+
+static QString format_time(GstClockTime time)
+{
+	if (!GST_CLOCK_TIME_IS_VALID(time))
+		return "none";
+
+	guint64 ms = time / GST_MSECOND;
+	return QString("%1:%2:%3.%4").arg(ms / 3600000).arg(ms / 60000 % 60, 2, 10, QChar('0'))
+			.arg(ms / 1000 % 60, 2, 10, QChar('0')).arg(ms % 1000, 3, 10, QChar('0'));
+}
+
+void WorkspaceWidget::update_link_statistics()
+{
+	for (auto pad : link_monitor.get_pads())
+	{
+		auto it = pad_ports.find(pad);
+		LinkMonitor::Sample sample;
+
+		if (it == pad_ports.end() || !link_monitor.sample(pad, sample))
+			continue;
+
+		QString info = QString::number(sample.buffers_per_second, 'f', 1) + " buf/s, " +
+				format_rate(sample.bytes_per_second) + ", pts " + format_time(sample.last_pts);
+
+		for (auto con : it->second->connections())
+			if (con->port1() && con->port2())
+				con->setInfo(info);
+	}
+}
+
+void WorkspaceWidget::update_element_profile()
+{
+	std::vector<std::pair<QNEBlock*, ElementProfiler::Percentiles>> profiles;
+	GstClockTime max_p50 = 0;
+
+	for (auto element : element_profiler.get_elements())
+	{
+		auto it = blocks.find(element);
+		ElementProfiler::Percentiles percentiles;
+
+		if (it == blocks.end() || !element_profiler.get_percentiles(element, percentiles))
+			continue;
+
+		profiles.push_back(std::make_pair(it->second, percentiles));
+		max_p50 = std::max(max_p50, percentiles.p50);
+	}
+
+	// the most expensive element is the hottest one
+	for (auto profile : profiles)
+	{
+		profile.first->setHeat(max_p50 ? double(profile.second.p50) / max_p50 : 0);
+		update_block_tooltip(profile.first);
+	}
+}
+
+void WorkspaceWidget::update_queue_levels()
+{
+	for (auto element : queue_monitor.get_elements())
+	{
+		auto it = blocks.find(element);
+		QueueMonitor::Status status;
+
+		if (it == blocks.end() || !queue_monitor.get_status(element, status))
+			continue;
+
+		queue_status[element] = status;
+		it->second->setFillLevel(status.has_level ? status.level : -1);
+		update_block_tooltip(it->second);
+	}
+}
+
+void WorkspaceWidget::zoom(int delta)
+{
+	qreal factor = std::pow(1.15, delta / 120.0);
+	qreal scale = view->transform().m11() * factor;
+
+	if (scale < 0.05 || scale > 8)
+		return;
+
+	view->scale(factor, factor);
+	update_detail_level();
+}
+
+void WorkspaceWidget::update_detail_level()
+{
+	bool detailed = view->transform().m11() >= QNEBlock::detailThreshold;
+
+	// visiting every port is only needed when the threshold is crossed
+	if (detailed == detailed_view)
+		return;
+
+	detailed_view = detailed;
+
+	for (auto block : blocks)
+		for (auto port : block.second->ports())
+			if (!(port->portFlags() & QNEPort::NamePort))
+				port->setLabelVisible(detailed);
+}
+
+void WorkspaceWidget::schedule_layout()
+{
+	if (bulk_update_depth == 0 && !auto_placed_blocks.empty())
+		layout_timer->start();
+}
+
+void WorkspaceWidget::request_layout()
+{
+	GraphLayout::Graph graph;
+	std::unordered_map<QNEBlock*, size_t> indices;
+
+	for (auto block : blocks)
+	{
+		QRectF rect = block.second->boundingRect();
+		indices[block.second] = graph.nodes.size();
+		graph.nodes.push_back({block.first, rect.width(), rect.height()});
+	}
+
+	for (auto block : blocks)
+	{
+		for (auto port : block.second->ports())
+		{
+			if (!port->isOutput())
+				continue;
+
+			for (auto con : port->connections())
+			{
+				if (!con->port1() || !con->port2())
+					continue;
+
+				QNEPort* peer = (con->port1() == port) ? con->port2() : con->port1();
+				auto it = indices.find(peer->block());
+
+				if (it != indices.end())
+					graph.edges.push_back(std::make_pair(indices[block.second], it->second));
+			}
+		}
+	}
+
+	layout_request = layout_engine->request(std::move(graph));
+}
+
+void WorkspaceWidget::layout_finished(unsigned int request)
+{
+	GraphLayout::Result result;
+
+	if (request != layout_request || !layout_engine->take_result(request, result))
+		return;
+
+	// the automatically placed blocks go below the ones placed by the user
+	QRectF fixed_rect;
+	for (auto block : blocks)
+		if (!auto_placed_blocks.count(block.second))
+			fixed_rect |= block.second->sceneBoundingRect();
+
+	QPointF origin = fixed_rect.isNull() ? QPointF(0, 0) :
+			QPointF(fixed_rect.left(), fixed_rect.bottom() + GraphLayout::node_spacing);
+	double top = std::numeric_limits<double>::max();
+
+	for (size_t i = 0; i < result.keys.size(); i++)
+	{
+		auto it = blocks.find(static_cast<GstElement*>(result.keys[i]));
+		if (it != blocks.end() && auto_placed_blocks.count(it->second))
+			top = std::min(top, result.positions[i].second);
+	}
+
+	for (size_t i = 0; i < result.keys.size(); i++)
+	{
+		auto it = blocks.find(static_cast<GstElement*>(result.keys[i]));
+
+		if (it != blocks.end() && auto_placed_blocks.count(it->second))
+			it->second->setPos(origin + QPointF(result.positions[i].first, result.positions[i].second - top));
+	}
+}
+
 void WorkspaceWidget::set_controller(CommandListener* controller)
 {
 	this->controller = controller;
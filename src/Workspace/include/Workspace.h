@@ -9,5 +9,9 @@
 #define WORKSPACE_H_
 
 #include "Workspace/WorkspaceWidget.h"
+#include "Workspace/LinkFeasibilityChecker.h"
+#include "Workspace/LinkMonitor.h"
+#include "Workspace/ElementProfiler.h"
+#include "Workspace/QueueMonitor.h"
 
 #endif /* WORKSPACE_H_ */
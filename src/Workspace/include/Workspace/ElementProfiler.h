@@ -0,0 +1,68 @@
+/*
+ * ElementProfiler.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef ELEMENTPROFILER_H_
+#define ELEMENTPROFILER_H_
+
+#include <gst/gst.h>
+#include <unordered_map>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/*
+ * Measures per-buffer processing time of elements: the time between a buffer
+ * entering a sink pad and the element pushing from its source pad in the same
+ * streaming thread. Durations go to a lock-free log2 histogram per element.
+ */
+class ElementProfiler
+{
+public:
+	struct Percentiles
+	{
+		guint64 count;
+		GstClockTime p50;
+		GstClockTime p99;
+	};
+
+	static constexpr int bucket_count = 40;
+
+private:
+	struct Histogram
+	{
+		std::atomic<guint64> buckets[bucket_count];
+
+		Histogram() { for (auto& bucket : buckets) bucket.store(0); }
+	};
+
+	struct Probe
+	{
+		std::shared_ptr<Histogram> histogram;
+		bool is_sink;
+	};
+
+	std::unordered_map<GstPad*, gulong> pads;
+	std::unordered_map<GstElement*, std::shared_ptr<Histogram>> histograms;
+
+	static GstPadProbeReturn probe_callback(GstPad* pad, GstPadProbeInfo* info, gpointer user_data);
+	static void destroy_probe(gpointer user_data);
+	static GstClockTime bucket_limit(int bucket);
+
+public:
+	~ElementProfiler();
+
+	void attach(GstElement* element);
+	void attach_pad(GstPad* pad);
+	void detach_pad(GstPad* pad);
+	void detach(GstElement* element);
+	void detach_all();
+
+	bool get_percentiles(GstElement* element, Percentiles& percentiles) const;
+	std::vector<GstElement*> get_elements() const;
+};
+
+#endif /* ELEMENTPROFILER_H_ */
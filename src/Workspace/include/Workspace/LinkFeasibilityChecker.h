@@ -0,0 +1,58 @@
+/*
+ * LinkFeasibilityChecker.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef LINKFEASIBILITYCHECKER_H_
+#define LINKFEASIBILITYCHECKER_H_
+
+#include <QObject>
+#include <gstreamermm.h>
+#include <condition_variable>
+#include <atomic>
+#include <thread>
+#include <mutex>
+
+/*
+ * Checks on a worker thread whether two ports can be linked.
+ * Only the latest request is evaluated; results of outdated requests are dropped.
+ */
+class LinkFeasibilityChecker : public QObject
+{
+	Q_OBJECT
+private:
+	struct Request
+	{
+		unsigned int id;
+		Glib::RefPtr<Gst::Element> src_parent;
+		Glib::RefPtr<Gst::Object> src_model;
+		Glib::RefPtr<Gst::Element> sink_parent;
+		Glib::RefPtr<Gst::Object> sink_model;
+	};
+
+	std::thread worker;
+	std::mutex mutex;
+	std::condition_variable condition;
+	Request pending;
+	bool has_pending;
+	bool stopped;
+	std::atomic<unsigned int> latest_id;
+
+	void run();
+
+public:
+	explicit LinkFeasibilityChecker(QObject* parent = 0);
+	virtual ~LinkFeasibilityChecker();
+
+	unsigned int request(const Glib::RefPtr<Gst::Element>& src_parent, const Glib::RefPtr<Gst::Object>& src_model,
+			const Glib::RefPtr<Gst::Element>& sink_parent, const Glib::RefPtr<Gst::Object>& sink_model);
+	void cancel();
+	bool is_latest(unsigned int id) const { return id == latest_id; }
+
+Q_SIGNALS:
+	void link_checked(unsigned int id, int status);
+};
+
+#endif /* LINKFEASIBILITYCHECKER_H_ */
@@ -0,0 +1,68 @@
+/*
+ * LinkMonitor.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef LINKMONITOR_H_
+#define LINKMONITOR_H_
+
+#include <gst/gst.h>
+#include <unordered_map>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/*
+ * Counts buffers flowing through source pads with buffer probes.
+ * Streaming threads only update atomic counters; statistics are read
+ * from the GUI thread by sample().
+ */
+class LinkMonitor
+{
+public:
+	struct Sample
+	{
+		double buffers_per_second;
+		double bytes_per_second;
+		GstClockTime last_pts;
+	};
+
+private:
+	struct Counters
+	{
+		std::atomic<guint64> buffers;
+		std::atomic<guint64> bytes;
+		std::atomic<guint64> last_pts;
+
+		Counters() : buffers(0), bytes(0), last_pts(GST_CLOCK_TIME_NONE) {}
+	};
+
+	struct Link
+	{
+		gulong probe_id;
+		std::shared_ptr<Counters> counters;
+		guint64 sampled_buffers;
+		guint64 sampled_bytes;
+		gint64 sampled_time;
+	};
+
+	std::unordered_map<GstPad*, Link> links;
+
+	static GstPadProbeReturn probe_callback(GstPad* pad, GstPadProbeInfo* info, gpointer user_data);
+	static void destroy_counters(gpointer user_data);
+
+public:
+	~LinkMonitor();
+
+	void attach(GstPad* src_pad);
+	void detach(GstPad* src_pad);
+	void detach_all();
+	bool is_attached(GstPad* src_pad) const { return links.count(src_pad) != 0; }
+
+	bool sample(GstPad* src_pad, Sample& sample);
+	std::vector<GstPad*> get_pads() const;
+};
+
+#endif /* LINKMONITOR_H_ */
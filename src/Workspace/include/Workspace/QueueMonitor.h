@@ -0,0 +1,70 @@
+/*
+ * QueueMonitor.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef QUEUEMONITOR_H_
+#define QUEUEMONITOR_H_
+
+#include <gst/gst.h>
+#include <unordered_map>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/*
+ * Watches queue, queue2 and multiqueue elements. Fill levels are polled
+ * on demand by get_status(); overrun and underrun signals only bump atomic
+ * counters in the streaming threads.
+ */
+class QueueMonitor
+{
+public:
+	struct Status
+	{
+		bool has_level;
+		double level;
+		guint current_buffers;
+		guint64 current_bytes;
+		GstClockTime current_time;
+		guint64 overruns;
+		guint64 underruns;
+	};
+
+private:
+	struct Counters
+	{
+		std::atomic<guint64> overruns;
+		std::atomic<guint64> underruns;
+
+		Counters() : overruns(0), underruns(0) {}
+	};
+
+	struct Queue
+	{
+		std::shared_ptr<Counters> counters;
+		std::vector<gulong> handlers;
+		bool has_level;
+	};
+
+	std::unordered_map<GstElement*, Queue> queues;
+
+	static void overrun_callback(GstElement* element, gpointer user_data);
+	static void underrun_callback(GstElement* element, gpointer user_data);
+	static void destroy_counters(gpointer user_data, GClosure* closure);
+	void connect_signal(GstElement* element, const char* signal, GCallback callback, Queue& queue);
+
+public:
+	~QueueMonitor();
+
+	bool attach(GstElement* element);
+	void detach(GstElement* element);
+	void detach_all();
+
+	bool get_status(GstElement* element, Status& status) const;
+	std::vector<GstElement*> get_elements() const;
+};
+
+#endif /* QUEUEMONITOR_H_ */
@@ -10,9 +10,18 @@
 
 #include "Commands.h"
 #include "qnelibrary.h"
+#include "LinkFeasibilityChecker.h"
+#include "utils/GraphLayout.h"
+#include "LinkMonitor.h"
+#include "ElementProfiler.h"
+#include "QueueMonitor.h"
 #include <QWidget>
+#include <QTimer>
 #include <QMimeData>
 #include <gstreamermm.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 class WorkspaceWidget : public QWidget, public CommandListener
 {
@@ -21,12 +30,50 @@ private:
 	constexpr static const char* active_style_sheet = "QFrame{ border: 1px solid red; border-radius: 4px; padding: 2px;}";
 	constexpr static const char* passive_style_sheet = "QFrame{ border: 1px solid black; border-radius: 4px; padding: 2px;}";
 
+	typedef std::pair<GstElement*, GstPadTemplate*> template_key;
+
+	struct template_key_hash
+	{
+		size_t operator()(const template_key& key) const
+		{
+			return std::hash<void*>()(key.first) * 31 + std::hash<void*>()(key.second);
+		}
+	};
+
 	CommandListener* controller;
 	QGraphicsView* view;
 	QGraphicsScene* scene;
 	QNEConnection* current_connection;
+	QNEPort* hovered_port;
+	int hovered_link_status;
+	unsigned int hovered_request;
+	LinkFeasibilityChecker* link_checker;
 	Glib::RefPtr<Gst::Pipeline> model;
 
+	std::unordered_map<GstElement*, QNEBlock*> blocks;
+	std::unordered_map<GstPad*, QNEPort*> pad_ports;
+	std::unordered_map<template_key, QNEPort*, template_key_hash> template_ports;
+
+	int bulk_update_depth;
+	std::unordered_set<QNEBlock*> deferred_blocks;
+
+	GraphLayout* layout_engine;
+	QTimer* layout_timer;
+	unsigned int layout_request;
+	std::unordered_set<QNEBlock*> auto_placed_blocks;
+	bool has_drop_position;
+	QPointF drop_position;
+
+	bool detailed_view;
+
+	LinkMonitor link_monitor;
+	ElementProfiler element_profiler;
+	QueueMonitor queue_monitor;
+	std::unordered_map<GstElement*, QueueMonitor::Status> queue_status;
+	QTimer* monitor_timer;
+	QTimer* queue_timer;
+	bool playing;
+
 	bool check_mime_data(const QMimeData* mime_data) const;
 	QString get_new_name(const QString& name);
 	QGraphicsItem* item_at(const QPointF &pos);
@@ -35,6 +82,17 @@ private:
 	QNEPort* find_port(const Glib::RefPtr<Gst::Pad>& pad);
 	QNEPort* find_port(const Glib::RefPtr<Gst::PadTemplate>& pad, const Glib::RefPtr<Gst::Element>& parent);
 	QNEBlock* find_block(const Glib::RefPtr<Gst::Element>& element);
+	QNEPort* add_port(QNEBlock* block, const Glib::RefPtr<Gst::Object>& model, bool is_output);
+	void unregister_port(QNEPort* port);
+
+	void execute(Command* command);
+	Command* create_link_command(const Glib::RefPtr<Gst::Object>& src, const Glib::RefPtr<Gst::Element>& src_parent,
+			const Glib::RefPtr<Gst::Object>& sink, const Glib::RefPtr<Gst::Element>& sink_parent);
+	void auto_plug(QNEPort* src_port, QNEPort* sink_port);
+	void schedule_layout();
+	void zoom(int delta);
+	void update_detail_level();
+	void update_block_tooltip(QNEBlock* block);
 
 public:
 	explicit WorkspaceWidget(const Glib::RefPtr<Gst::Pipeline>& model, QWidget* parent = 0);
@@ -51,11 +109,22 @@ public:
 	void future_connection_added(const Glib::RefPtr<Gst::PadTemplate>& src_tpl,
 			const Glib::RefPtr<Gst::Element>& parent, const Glib::RefPtr<Gst::Pad>& sink);
 	void future_connection_removed(const ConnectCommand::future_connection_pads& conn);
+	void bulk_update_started();
+	void bulk_update_finished();
+	void state_changed(State state);
 	void set_controller(CommandListener* controller);
 
 	QPointF get_block_location(const Glib::RefPtr<Gst::Element>& element);
 	void set_block_location(const Glib::RefPtr<Gst::Element>& element, double x, double y);
 
+private Q_SLOTS:
+	void link_checked(unsigned int request, int status);
+	void request_layout();
+	void layout_finished(unsigned int request);
+	void update_link_statistics();
+	void update_element_profile();
+	void update_queue_levels();
+
 Q_SIGNALS:
 	void current_element_changed(const Glib::RefPtr<Gst::Element>& element);
 };
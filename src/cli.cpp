@@ -0,0 +1,211 @@
+/*
+ * cli.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "Console/ScriptRunner.h"
+#include "controller/FileWriter.h"
+#include "controller/FileLoader.h"
+#include "controller/BinaryFileWriter.h"
+#include "controller/BinaryFileLoader.h"
+#include "controller/CodeGenerator.h"
+#include "utils/GraphLayout.h"
+#include <gstreamermm.h>
+#include <chrono>
+#include <iostream>
+#include <unordered_map>
+
+using namespace Gst;
+using Glib::RefPtr;
+
+static void print_usage(const char* name)
+{
+	std::cerr << "Usage: " << name << " [-l project.gstc] [-o project.gstc] [-g code.cpp] [-w] [script...]" << std::endl
+			<< "  -l FILE   load a gst-creator project before running the scripts" << std::endl
+			<< "  -o FILE   save the pipeline as a gst-creator project, *.gstcb files are saved in the binary format" << std::endl
+			<< "  -g FILE   generate C++ code of the pipeline" << std::endl
+			<< "  -w        wait for EOS or error if the pipeline is left running" << std::endl
+			<< "  script    file with console commands, `-` reads from standard input" << std::endl;
+}
+
+// blocks are laid out the same way the workspace places them automatically
+static std::unordered_map<GstElement*, QPointF> layout_blocks(const RefPtr<Pipeline>& model)
+{
+	GraphLayout::Graph graph;
+	std::unordered_map<GstElement*, size_t> indices;
+
+	Gst::Iterator<Element> elements = model->iterate_elements();
+	while (elements.next())
+	{
+		indices[elements->gobj()] = graph.nodes.size();
+		graph.nodes.push_back({elements->gobj(), 150, 80});
+	}
+
+	for (auto index : indices)
+	{
+		Gst::Iterator<Pad> pads = Glib::wrap(index.first, true)->iterate_src_pads();
+		while (pads.next())
+		{
+			RefPtr<Pad> peer = pads->get_peer();
+			if (!peer)
+				continue;
+
+			GstElement* peer_parent = gst_pad_get_parent_element(peer->gobj());
+			if (!peer_parent)
+				continue;
+
+			auto it = indices.find(peer_parent);
+			if (it != indices.end())
+				graph.edges.push_back(std::make_pair(index.second, it->second));
+
+			gst_object_unref(peer_parent);
+		}
+	}
+
+	std::unordered_map<GstElement*, QPointF> locations;
+	auto positions = GraphLayout::compute(graph);
+
+	for (size_t i = 0; i < positions.size(); i++)
+		locations[static_cast<GstElement*>(graph.nodes[i].key)] = QPointF(positions[i].first, positions[i].second);
+
+	return locations;
+}
+
+static void wait_for_pipeline(const RefPtr<Pipeline>& model)
+{
+	State state, pending;
+	model->get_state(state, pending, CLOCK_TIME_NONE);
+
+	if (state != STATE_PLAYING && state != STATE_PAUSED)
+		return;
+
+	GstBus* bus = gst_element_get_bus(GST_ELEMENT(model->gobj()));
+	GstMessage* message = gst_bus_timed_pop_filtered(bus, GST_CLOCK_TIME_NONE,
+			static_cast<GstMessageType>(GST_MESSAGE_EOS | GST_MESSAGE_ERROR));
+
+	std::string error;
+	if (GST_MESSAGE_TYPE(message) == GST_MESSAGE_ERROR)
+	{
+		GError* err = nullptr;
+		gst_message_parse_error(message, &err, nullptr);
+		error = err->message;
+		g_error_free(err);
+	}
+
+	gst_message_unref(message);
+	gst_object_unref(bus);
+	model->set_state(STATE_NULL);
+
+	if (!error.empty())
+		throw std::runtime_error("pipeline error: " + error);
+}
+
+int main(int argc, char *argv[])
+{
+	Gst::init(argc, argv);
+
+	std::string input_file, project_file, code_file;
+	std::vector<std::string> scripts;
+	bool wait = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+
+		if ((arg == "-o" || arg == "-g") && i + 1 < argc)
+			(arg == "-o" ? project_file : code_file) = argv[++i];
+		else if (arg == "-l" && i + 1 < argc)
+			input_file = argv[++i];
+		else if (arg == "-w")
+			wait = true;
+		else if (arg == "-h" || arg == "--help")
+		{
+			print_usage(argv[0]);
+			return 0;
+		}
+		else if (arg[0] == '-' && arg != "-")
+		{
+			print_usage(argv[0]);
+			return 1;
+		}
+		else
+			scripts.push_back(arg);
+	}
+
+	if (scripts.empty() && input_file.empty())
+	{
+		print_usage(argv[0]);
+		return 1;
+	}
+
+	RefPtr<Pipeline> model = Pipeline::create("main-pipeline");
+	ScriptRunner runner(model);
+	std::unordered_map<GstElement*, QPointF> loaded_locations;
+
+	try
+	{
+		if (!input_file.empty())
+		{
+			auto pos_setter = [&loaded_locations](const RefPtr<Element>& element, double x, double y) {
+				loaded_locations[element->gobj()] = QPointF(x, y);
+			};
+
+			if (BinaryProject::is_binary_file(input_file))
+				BinaryFileLoader(input_file, model, pos_setter).load_model({});
+			else
+				FileLoader(input_file, model, pos_setter).load_model({});
+		}
+
+		auto start = std::chrono::steady_clock::now();
+
+		for (auto script : scripts)
+		{
+			try
+			{
+				if (script == "-")
+					runner.run(std::cin);
+				else
+					runner.run_file(script);
+			}
+			catch (const std::exception& ex)
+			{
+				throw std::runtime_error(script + ", " + ex.what());
+			}
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+		std::cerr << runner.get_executed_count() << " commands executed in " << elapsed.count() << " ms" << std::endl;
+
+		if (!project_file.empty())
+		{
+			auto locations = layout_blocks(model);
+			auto finder = [&locations, &loaded_locations](const RefPtr<Element>& element) {
+				auto it = loaded_locations.find(element->gobj());
+				return it != loaded_locations.end() ? it->second : locations[element->gobj()];
+			};
+
+			if (BinaryProject::is_binary_file(project_file))
+				BinaryFileWriter(project_file, model, finder).save_model();
+			else
+				FileWriter(project_file, model, finder).save_model();
+		}
+
+		if (!code_file.empty())
+			CodeGenerator(model).generate_code(code_file);
+
+		if (wait)
+			wait_for_pipeline(model);
+	}
+	catch (const std::exception& ex)
+	{
+		std::cerr << "Error: " << ex.what() << std::endl;
+		model->set_state(STATE_NULL);
+		return 1;
+	}
+
+	model->set_state(STATE_NULL);
+
+	return 0;
+}
@@ -0,0 +1,240 @@
+/*
+ * BinaryFileLoader.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "BinaryFileLoader.h"
+#include "Properties/Property.h"
+#include "utils/GstUtils.h"
+#include <memory>
+#include <stdexcept>
+
+using namespace std;
+using Glib::RefPtr;
+using namespace Gst;
+
+BinaryFileLoader::BinaryFileLoader(const string& filename, const RefPtr<Pipeline>& model, FileLoader::position_setter pos_setter)
+: filename(filename),
+  model(model),
+  pos_setter(pos_setter),
+  file(filename.c_str()),
+  data(nullptr),
+  size(0)
+{}
+
+void BinaryFileLoader::map_file()
+{
+	if (!file.open(QIODevice::ReadOnly))
+		throw runtime_error("Cannot open file " + filename + " for reading");
+
+	size = file.size();
+	data = size >= static_cast<qint64>(sizeof(BinaryProject::Header)) ? file.map(0, size) : nullptr;
+
+	if (data == nullptr)
+		throw runtime_error("Cannot map file " + filename);
+
+	auto header = reinterpret_cast<const BinaryProject::Header*>(data);
+
+	if (header->magic != BinaryProject::magic || header->version != BinaryProject::version)
+		throw runtime_error(filename + " is not a supported binary project file");
+}
+
+template<typename T>
+const T* BinaryFileLoader::get_section(const BinaryProject::Section& section) const
+{
+	if (section.offset % alignof(T) != 0 || section.offset > size ||
+			section.count > (size - section.offset) / sizeof(T))
+		throw runtime_error("Corrupted binary project file " + filename);
+
+	return reinterpret_cast<const T*>(data + section.offset);
+}
+
+const char* BinaryFileLoader::get_string(uint32_t index) const
+{
+	auto header = reinterpret_cast<const BinaryProject::Header*>(data);
+	auto strings = get_section<BinaryProject::String>(header->strings);
+	auto string_data = get_section<char>(header->string_data);
+
+	if (index >= header->strings.count || strings[index].offset >= header->string_data.count ||
+			strings[index].length >= header->string_data.count - strings[index].offset ||
+			string_data[strings[index].offset + strings[index].length] != '\0')
+		throw runtime_error("Corrupted binary project file " + filename);
+
+	return string_data + strings[index].offset;
+}
+
+void BinaryFileLoader::set_property(const RefPtr<Element>& element, const BinaryProject::Property& record)
+{
+	const char* name = get_string(record.name);
+	GParamSpec* spec = g_object_class_find_property(G_OBJECT_GET_CLASS(element->gobj()), name);
+
+	if (spec == nullptr || !(spec->flags & G_PARAM_WRITABLE) || (spec->flags & G_PARAM_CONSTRUCT_ONLY))
+		return;
+
+	// the element may have changed since the project was saved
+	if (record.kind != BinaryProject::get_value_kind(spec->value_type))
+		return;
+
+	if (record.kind == BinaryProject::ValueKind::SERIALIZED)
+	{
+		std::unique_ptr<Property> property(Property::build_property(spec, element, get_string(record.string_value)));
+		if (property)
+			property->set_value();
+		return;
+	}
+
+	GValue value = G_VALUE_INIT;
+	g_value_init(&value, spec->value_type);
+
+	switch (record.kind)
+	{
+	case BinaryProject::ValueKind::BOOLEAN: g_value_set_boolean(&value, record.int_value); break;
+	case BinaryProject::ValueKind::INT: g_value_set_int(&value, record.int_value); break;
+	case BinaryProject::ValueKind::UINT: g_value_set_uint(&value, record.uint_value); break;
+	case BinaryProject::ValueKind::LONG: g_value_set_long(&value, record.int_value); break;
+	case BinaryProject::ValueKind::ULONG: g_value_set_ulong(&value, record.uint_value); break;
+	case BinaryProject::ValueKind::INT64: g_value_set_int64(&value, record.int_value); break;
+	case BinaryProject::ValueKind::UINT64: g_value_set_uint64(&value, record.uint_value); break;
+	case BinaryProject::ValueKind::FLOAT: g_value_set_float(&value, record.double_value); break;
+	case BinaryProject::ValueKind::DOUBLE: g_value_set_double(&value, record.double_value); break;
+	case BinaryProject::ValueKind::ENUM: g_value_set_enum(&value, record.int_value); break;
+	default:
+		g_value_unset(&value);
+		throw runtime_error("Corrupted binary project file " + filename);
+	}
+
+	g_object_set_property(G_OBJECT(element->gobj()), name, &value);
+
+	g_value_unset(&value);
+}
+
+void BinaryFileLoader::load_model(std::vector<CommandListener*> listeners)
+{
+	BulkUpdateScope bulk_update(listeners);
+
+	GstUtils::clean_model(model);
+	map_file();
+
+	auto header = reinterpret_cast<const BinaryProject::Header*>(data);
+	auto elements = get_section<BinaryProject::Element>(header->elements);
+	auto properties = get_section<BinaryProject::Property>(header->properties);
+	auto pads = get_section<BinaryProject::Pad>(header->pads);
+	auto links = get_section<BinaryProject::Link>(header->links);
+	auto future_connections = get_section<BinaryProject::FutureConnection>(header->future_connections);
+
+	std::vector<RefPtr<Element>> created;
+	created.reserve(header->elements.count);
+
+	auto get_element = [&created, this](uint32_t index) -> RefPtr<Element> {
+		if (index == BinaryProject::none)
+			return RefPtr<Element>(model);
+		if (index >= created.size())
+			throw runtime_error("Corrupted binary project file " + filename);
+		return created[index];
+	};
+
+	// parents precede their children, so every parent exists when a child is added
+	for (uint32_t i = 0; i < header->elements.count; i++)
+	{
+		const BinaryProject::Element& record = elements[i];
+		RefPtr<Element> parent = get_element(record.parent);
+		RefPtr<Element> element = ElementFactory::create_element(get_string(record.factory), get_string(record.name));
+
+		if (!element)
+			throw runtime_error(string("Cannot create element ") + get_string(record.factory));
+
+		AddCommand cmd(ObjectType::ELEMENT, parent, element);
+		cmd.run_command(listeners);
+		created.push_back(element);
+
+		if (record.has_location)
+			pos_setter(element, record.x, record.y);
+	}
+
+	for (uint32_t i = 0; i < header->properties.count; i++)
+		set_property(get_element(properties[i].element), properties[i]);
+
+	// requested pads may get other names than the saved ones, so pads are referenced by their records
+	std::vector<RefPtr<Pad>> created_pads(header->pads.count);
+
+	auto get_pad = [&created_pads, this](uint32_t index) -> RefPtr<Pad> {
+		if (index >= created_pads.size())
+			throw runtime_error("Corrupted binary project file " + filename);
+		return created_pads[index];
+	};
+
+	for (uint32_t i = 0; i < header->pads.count; i++)
+	{
+		if (pads[i].ghost_target != BinaryProject::none)
+			continue;
+
+		RefPtr<Element> element = get_element(pads[i].element);
+		created_pads[i] = element->get_static_pad(get_string(pads[i].name));
+
+		if (created_pads[i] || pads[i].pad_template == BinaryProject::none)
+			continue;
+
+		RefPtr<PadTemplate> pad_template = element->get_pad_template(get_string(pads[i].pad_template));
+
+		if (pad_template && pad_template->get_presence() == PAD_REQUEST)
+		{
+			AddCommand cmd(ObjectType::PAD, element, pad_template);
+			created_pads[i] = RefPtr<Pad>::cast_static(cmd.run_command_ret(listeners));
+		}
+	}
+
+	// inner bins are stored after outer ones, and their ghost pads may be targets of the outer ones
+	for (uint32_t i = header->pads.count; i-- > 0;)
+	{
+		if (pads[i].ghost_target == BinaryProject::none)
+			continue;
+
+		RefPtr<Element> element = get_element(pads[i].element);
+		RefPtr<Pad> target = get_pad(pads[i].ghost_target);
+		created_pads[i] = element->get_static_pad(get_string(pads[i].name));
+
+		if (!target || created_pads[i])
+			continue;
+
+		AddCommand cmd(ObjectType::PAD, element, GhostPad::create(target, get_string(pads[i].name)));
+		created_pads[i] = RefPtr<Pad>::cast_static(cmd.run_command_ret(listeners));
+	}
+
+	for (uint32_t i = 0; i < header->links.count; i++)
+	{
+		RefPtr<Pad> src_pad = get_pad(links[i].src_pad), sink_pad = get_pad(links[i].sink_pad);
+
+		if (src_pad && sink_pad && !src_pad->is_linked())
+		{
+			ConnectCommand cmd(src_pad, sink_pad);
+			cmd.run_command(listeners);
+		}
+	}
+
+	for (uint32_t i = 0; i < header->future_connections.count; i++)
+	{
+		const BinaryProject::FutureConnection& record = future_connections[i];
+		RefPtr<Element> src = get_element(record.src_element);
+
+		if (record.sink_pad == BinaryProject::none)
+		{
+			ConnectCommand cmd(src, get_element(record.sink_element), true);
+			cmd.run_command(listeners);
+			continue;
+		}
+
+		RefPtr<PadTemplate> pad_template = src->get_pad_template(get_string(record.pad_template));
+		RefPtr<Pad> sink_pad = get_pad(record.sink_pad);
+
+		if (pad_template && sink_pad)
+		{
+			ConnectCommand cmd(pad_template, src, sink_pad);
+			cmd.run_command(listeners);
+		}
+	}
+
+	file.unmap(const_cast<uchar*>(data));
+	data = nullptr;
+}
@@ -0,0 +1,273 @@
+/*
+ * BinaryFileWriter.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "BinaryFileWriter.h"
+#include "Properties/Property.h"
+#include "utils/FutureConnectionTable.h"
+#include "utils/GstUtils.h"
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+using namespace std;
+using Glib::RefPtr;
+using namespace Gst;
+
+constexpr uint32_t BinaryProject::magic;
+constexpr uint32_t BinaryProject::version;
+constexpr uint32_t BinaryProject::none;
+
+BinaryFileWriter::BinaryFileWriter(const string& filename, const RefPtr<Pipeline>& model, FileWriter::find_block finder)
+: filename(filename),
+  model(model),
+  finder(finder)
+{}
+
+uint32_t BinaryFileWriter::add_string(const string& text)
+{
+	auto it = string_indices.find(text);
+
+	if (it != string_indices.end())
+		return it->second;
+
+	uint32_t index = strings.size();
+	strings.push_back({static_cast<uint32_t>(string_data.size()), static_cast<uint32_t>(text.size())});
+	string_data.append(text.c_str(), text.size() + 1);
+	string_indices[text] = index;
+
+	return index;
+}
+
+uint32_t BinaryFileWriter::find_element(const RefPtr<Element>& element) const
+{
+	if (!element)
+		return BinaryProject::none;
+
+	auto it = element_indices.find(element->gobj());
+
+	return (it == element_indices.end()) ? BinaryProject::none : it->second;
+}
+
+uint32_t BinaryFileWriter::find_pad(const RefPtr<Pad>& pad) const
+{
+	if (!pad)
+		return BinaryProject::none;
+
+	auto it = pad_indices.find(pad->gobj());
+
+	return (it == pad_indices.end()) ? BinaryProject::none : it->second;
+}
+
+void BinaryFileWriter::add_element(const RefPtr<Element>& element, uint32_t parent)
+{
+	uint32_t index = BinaryProject::none;
+
+	if (element != model)
+	{
+		index = elements.size();
+		element_indices[element->gobj()] = index;
+		element_objects.push_back(element);
+
+		BinaryProject::Element record = {add_string(element->get_name()),
+				add_string(element->get_factory()->get_name()), parent, 0, 0, 0};
+
+		if (parent == BinaryProject::none)
+		{
+			QPointF location = finder(element);
+			record.has_location = 1;
+			record.x = location.x();
+			record.y = location.y();
+		}
+
+		elements.push_back(record);
+	}
+
+	add_properties(element, index);
+	add_pads(element, index);
+
+	if (GstUtils::is_container(element, model))
+	{
+		auto iterator = RefPtr<Bin>::cast_static(element)->iterate_elements();
+		std::vector<RefPtr<Element>> children;
+
+		while (iterator.next())
+			children.push_back(*iterator);
+
+		for (auto child : children)
+			add_element(child, index);
+	}
+}
+
+void BinaryFileWriter::add_properties(const RefPtr<Element>& element, uint32_t index)
+{
+	guint property_count;
+	GParamSpec **property_specs = g_object_class_list_properties(
+			G_OBJECT_GET_CLASS(element->gobj()), &property_count);
+
+	for (guint i = 0; i < property_count; i++)
+	{
+		GParamSpec* spec = property_specs[i];
+
+		if (!GstUtils::is_stored_property(spec, element))
+			continue;
+
+		BinaryProject::Property record;
+		record.element = index;
+		record.kind = BinaryProject::get_value_kind(spec->value_type);
+		record.string_value = BinaryProject::none;
+		record.uint_value = 0;
+
+		// other types are stored as in the XML format, if they are supported at all
+		if (record.kind == BinaryProject::ValueKind::SERIALIZED)
+		{
+			std::unique_ptr<Property> property(Property::build_property(spec, element, ""));
+
+			if (!property)
+				continue;
+
+			record.string_value = add_string(property->get_str_value());
+		}
+		else
+		{
+			GValue value = G_VALUE_INIT;
+			g_value_init(&value, spec->value_type);
+			g_object_get_property(G_OBJECT(element->gobj()), spec->name, &value);
+
+			switch (record.kind)
+			{
+			case BinaryProject::ValueKind::BOOLEAN: record.int_value = g_value_get_boolean(&value); break;
+			case BinaryProject::ValueKind::INT: record.int_value = g_value_get_int(&value); break;
+			case BinaryProject::ValueKind::UINT: record.uint_value = g_value_get_uint(&value); break;
+			case BinaryProject::ValueKind::LONG: record.int_value = g_value_get_long(&value); break;
+			case BinaryProject::ValueKind::ULONG: record.uint_value = g_value_get_ulong(&value); break;
+			case BinaryProject::ValueKind::INT64: record.int_value = g_value_get_int64(&value); break;
+			case BinaryProject::ValueKind::UINT64: record.uint_value = g_value_get_uint64(&value); break;
+			case BinaryProject::ValueKind::FLOAT: record.double_value = g_value_get_float(&value); break;
+			case BinaryProject::ValueKind::DOUBLE: record.double_value = g_value_get_double(&value); break;
+			case BinaryProject::ValueKind::ENUM: record.int_value = g_value_get_enum(&value); break;
+			default: break;
+			}
+
+			g_value_unset(&value);
+		}
+
+		record.name = add_string(spec->name);
+		properties.push_back(record);
+	}
+
+	g_free(property_specs);
+}
+
+void BinaryFileWriter::add_pads(const RefPtr<Element>& element, uint32_t index)
+{
+	if (index == BinaryProject::none)
+		return;
+
+	auto iterator = element->iterate_pads();
+
+	while (iterator.next())
+	{
+		BinaryProject::Pad record = {index, add_string(iterator->get_name()), BinaryProject::none, BinaryProject::none};
+
+		if (iterator->get_pad_template())
+			record.pad_template = add_string(iterator->get_pad_template()->get_name());
+
+		// targets are children of the bin, so their records are known after the whole tree is added
+		if (GST_IS_GHOST_PAD(iterator->gobj()) && GstUtils::is_container(element, model))
+		{
+			RefPtr<Pad> target = RefPtr<GhostPad>::cast_static(*iterator)->get_target();
+			if (target)
+				ghost_targets.push_back(std::make_pair(pads.size(), target));
+		}
+
+		pad_indices[iterator->gobj()] = pads.size();
+		pads.push_back(record);
+	}
+}
+
+void BinaryFileWriter::resolve_ghost_targets()
+{
+	for (auto ghost_target : ghost_targets)
+		pads[ghost_target.first].ghost_target = find_pad(ghost_target.second);
+}
+
+void BinaryFileWriter::add_links()
+{
+	for (auto element : element_objects)
+	{
+		auto iterator = element->iterate_src_pads();
+
+		while (iterator.next())
+		{
+			// links to the inside of a ghost pad are restored from its target
+			uint32_t src_pad = find_pad(*iterator), sink_pad = find_pad(iterator->get_peer());
+
+			if (src_pad != BinaryProject::none && sink_pad != BinaryProject::none)
+				links.push_back({src_pad, sink_pad});
+		}
+	}
+}
+
+void BinaryFileWriter::add_future_connections()
+{
+	auto& table = FutureConnectionTable::get(model);
+
+	for (auto connection : table.get_element_connections())
+	{
+		uint32_t src = find_element(connection.first), sink = find_element(connection.second);
+
+		if (src != BinaryProject::none && sink != BinaryProject::none)
+			future_connections.push_back({src, BinaryProject::none, sink, BinaryProject::none});
+	}
+
+	for (auto connection : table.get_pad_connections())
+	{
+		uint32_t src = find_element(connection.first.first), sink_pad = find_pad(connection.second);
+
+		if (src != BinaryProject::none && sink_pad != BinaryProject::none)
+			future_connections.push_back({src, add_string(connection.first.second->get_name()),
+				pads[sink_pad].element, sink_pad});
+	}
+}
+
+template<typename T>
+static void append_section(std::string& buffer, BinaryProject::Section& section, const T* data, size_t count)
+{
+	buffer.resize((buffer.size() + 7) & ~size_t(7), '\0');
+
+	section.offset = buffer.size();
+	section.count = count;
+	buffer.append(reinterpret_cast<const char*>(data), count * sizeof(T));
+}
+
+void BinaryFileWriter::save_model()
+{
+	add_element(model, BinaryProject::none);
+	resolve_ghost_targets();
+	add_links();
+	add_future_connections();
+
+	BinaryProject::Header header;
+	std::memset(&header, 0, sizeof(header));
+	header.magic = BinaryProject::magic;
+	header.version = BinaryProject::version;
+
+	std::string buffer(sizeof(header), '\0');
+	append_section(buffer, header.strings, strings.data(), strings.size());
+	append_section(buffer, header.string_data, string_data.data(), string_data.size());
+	append_section(buffer, header.elements, elements.data(), elements.size());
+	append_section(buffer, header.properties, properties.data(), properties.size());
+	append_section(buffer, header.pads, pads.data(), pads.size());
+	append_section(buffer, header.links, links.data(), links.size());
+	append_section(buffer, header.future_connections, future_connections.data(), future_connections.size());
+	std::memcpy(&buffer[0], &header, sizeof(header));
+
+	QFile file(filename.c_str());
+
+	if (!file.open(QIODevice::WriteOnly) || file.write(buffer.data(), buffer.size()) != static_cast<qint64>(buffer.size()))
+		throw runtime_error("Cannot open file " + filename + " for writting");
+}
@@ -193,7 +193,7 @@ void CodeGenerator::generate_dynamic_links()
 {
 	output << "void Creator::dynamic_links()" << endl << "{" << endl;
 
-	auto future_connections = ConnectCommand::get_future_connections_pads();
+	auto future_connections = FutureConnectionTable::get(model).get_pad_connections();
 
 	for (auto connection : future_connections)
 	{
@@ -7,6 +7,7 @@
 
 #include "FileLoader.h"
 #include "utils/GstUtils.h"
+#include "utils/ThreadPool.h"
 
 using namespace std;
 using namespace Gst;
@@ -15,6 +16,7 @@ using Glib::RefPtr;
 FileLoader::FileLoader(const string& filename, const RefPtr<Pipeline>& model, position_setter pos_setter)
 : filename(filename),
   model(model),
+  next_element(0),
   file(nullptr),
   pos_setter(pos_setter)
 {}
@@ -31,16 +33,69 @@ void FileLoader::open_file()
 
 	if (!file->open(QIODevice::ReadOnly))
 		throw runtime_error("Cannot open file " + filename + " for writting");
+}
+
+// element creation may load heavy plugins, so all elements of the project are created up front
+// in parallel and then added and linked in file order by the main parsing pass, which streams the file again
+void FileLoader::create_elements()
+{
+	std::vector<std::pair<std::string, std::string>> descriptions;
+	QXmlStreamReader scanner(file);
+
+	while (!scanner.atEnd() && !scanner.hasError())
+	{
+		if (scanner.readNext() != QXmlStreamReader::StartElement || scanner.name() != "element")
+			continue;
+
+		QXmlStreamAttributes attributes = scanner.attributes();
+
+		if (attributes.hasAttribute("factory"))
+			descriptions.push_back(std::make_pair(
+					attributes.value("factory").toString().toUtf8().constData(),
+					attributes.hasAttribute("name") ? attributes.value("name").toString().toUtf8().constData() : ""));
+	}
+
+	std::vector<GstElement*> elements(descriptions.size(), nullptr);
 
+	// only the C API is used in the workers, C++ wrappers are created on the main thread
+	ThreadPool::parallel_for(descriptions.size(), [&descriptions, &elements](size_t i) {
+		GstElement* element = gst_element_factory_make(descriptions[i].first.c_str(),
+				descriptions[i].second.empty() ? nullptr : descriptions[i].second.c_str());
+
+		if (element)
+			elements[i] = GST_ELEMENT(gst_object_ref_sink(element));
+	});
+
+	created_elements.clear();
+	next_element = 0;
+
+	for (auto element : elements)
+		created_elements.push_back(element ? Glib::wrap(element, false) : RefPtr<Element>());
+
+	for (size_t i = 0; i < created_elements.size(); i++)
+		if (!created_elements[i])
+			throw runtime_error("Cannot create element of type " + descriptions[i].first);
+
+	// syntax errors are reported by the main pass
+	if (!file->seek(0))
+		throw runtime_error("Cannot read file " + filename);
+
+	reader.clear();
 	reader.setDevice(file);
 }
 
 void FileLoader::load_model(std::vector<CommandListener*> listeners)
 {
+	BulkUpdateScope bulk_update(listeners);
+
 	GstUtils::clean_model(model);
 	open_file();
 
 	this->listeners = listeners;
+	create_elements();
+	connections.clear();
+	element_ids.clear();
+	pad_ids.clear();
 
 	while (!reader.atEnd() && !reader.hasError())
 	{
@@ -57,6 +112,7 @@ void FileLoader::load_model(std::vector<CommandListener*> listeners)
 		{
 			if (reader.name() == "element")
 			{
+				create_ghost_pads(current_element);
 				current_element = element_stack.top();
 				element_stack.pop();
 			}
@@ -66,12 +122,19 @@ void FileLoader::load_model(std::vector<CommandListener*> listeners)
 	if (reader.hasError())
 		throw std::runtime_error(reader.errorString().toUtf8().constData());
 
+	create_ghost_pads(model);
+	created_elements.clear();
+
 	for (auto con : connections)
 	{
-		RefPtr<Pad> src_pad = GstUtils::find_pad(con.first.c_str(), model);
-		RefPtr<Pad> sink_pad = GstUtils::find_pad(con.second.c_str(), model);
+		RefPtr<Pad> src_pad = find_pad(con.src_id, con.src);
+		RefPtr<Pad> sink_pad = find_pad(con.sink_id, con.sink);
+
+		// links of ghost pads are stored from both sides
+		if (src_pad && src_pad->get_direction() == PAD_SINK)
+			std::swap(src_pad, sink_pad);
 
-		if (src_pad && sink_pad)
+		if (src_pad && sink_pad && !src_pad->is_linked())
 		{
 			ConnectCommand cmd(src_pad, sink_pad);
 			cmd.run_command(listeners);
@@ -79,6 +142,66 @@ void FileLoader::load_model(std::vector<CommandListener*> listeners)
 	}
 }
 
+void FileLoader::create_ghost_pads(const RefPtr<Element>& bin)
+{
+	// ghost pads of a bin are the last ones registered when its element ends
+	while (!ghost_pads.empty() && ghost_pads.back().bin == bin)
+	{
+		GhostPadInfo info = ghost_pads.back();
+		ghost_pads.pop_back();
+
+		RefPtr<Pad> target = find_pad(info.target_id, info.target);
+
+		if (!target || bin->get_static_pad(info.name))
+			continue;
+
+		AddCommand cmd(ObjectType::PAD, bin, GhostPad::create(target, info.name));
+		RefPtr<Pad> pad = RefPtr<Pad>::cast_static(cmd.run_command_ret(listeners));
+
+		if (info.id >= 0)
+			pad_ids[info.id] = pad;
+	}
+}
+
+// files written by older versions have no ids, so their objects are still looked up by path
+RefPtr<Element> FileLoader::find_element(int id, const Glib::ustring& path)
+{
+	if (id >= 0)
+	{
+		auto it = element_ids.find(id);
+		return it != element_ids.end() ? it->second : RefPtr<Element>();
+	}
+
+	return path.empty() ? RefPtr<Element>() : GstUtils::find_element(path.c_str(), model);
+}
+
+RefPtr<Pad> FileLoader::find_pad(int id, const Glib::ustring& path)
+{
+	if (id >= 0)
+	{
+		auto it = pad_ids.find(id);
+		return it != pad_ids.end() ? it->second : RefPtr<Pad>();
+	}
+
+	return path.empty() ? RefPtr<Pad>() : GstUtils::find_pad(path.c_str(), model);
+}
+
+Glib::ustring FileLoader::get_pad_path(const Glib::ustring& pad_name)
+{
+	return Glib::ustring(GstUtils::generate_element_path(current_element, model)) + ":" + pad_name;
+}
+
+int FileLoader::get_id_attribute(const char* attribute_name)
+{
+	if (!reader.attributes().hasAttribute(attribute_name))
+		return -1;
+
+	bool conv_ok;
+	int id = reader.attributes().value(attribute_name).toString().toInt(&conv_ok);
+
+	return conv_ok && id >= 0 ? id : -1;
+}
+
 Glib::ustring FileLoader::get_attribute(const char* attribute_name)
 {
 	return (reader.attributes().hasAttribute(attribute_name)) ?
@@ -89,18 +212,27 @@ Glib::ustring FileLoader::get_attribute(const char* attribute_name)
 void FileLoader::process_start_element()
 {
 	if (reader.name() == "pipeline")
+	{
 		current_element = model;
+
+		int id = get_id_attribute("id");
+		if (id >= 0)
+			element_ids[id] = model;
+	}
 	else if (reader.name() == "element" && reader.attributes().hasAttribute("factory"))
 	{
-		RefPtr<Element> new_element =
-				(reader.attributes().hasAttribute("name")) ?
-						ElementFactory::create_element(get_attribute("factory"),
-								get_attribute("name")) :
-								ElementFactory::create_element(get_attribute("factory"));
+		if (next_element >= created_elements.size())
+			throw runtime_error("Unexpected element in file " + filename);
+
+		RefPtr<Element> new_element = created_elements[next_element++];
 
 		AddCommand cmd(ObjectType::ELEMENT, current_element, new_element);
 		cmd.run_command(listeners);
 
+		int id = get_id_attribute("id");
+		if (id >= 0)
+			element_ids[id] = new_element;
+
 		if (reader.attributes().hasAttribute("X") && reader.attributes().hasAttribute("Y"))
 		{
 			bool conv_ok;
@@ -128,8 +260,8 @@ void FileLoader::process_start_element()
 
 		if (reader.readNext() == QXmlStreamReader::Characters)
 		{
-			Property* prop = Property::build_property(spec, current_element,
-					reader.text().toString().toUtf8().constData());
+			std::unique_ptr<Property> prop(Property::build_property(spec, current_element,
+					reader.text().toString().toUtf8().constData()));
 			if (prop)
 				prop->set_value();
 		}
@@ -138,30 +270,57 @@ void FileLoader::process_start_element()
 	{
 		Glib::ustring pad_name = get_attribute("name"),
 				pad_template_name = get_attribute("template"),
-				pad_is_linked = get_attribute("is_linked");
+				pad_is_linked = get_attribute("is_linked"),
+				ghost_target = get_attribute("ghost-target");
+
+		bool is_linked = pad_is_linked == "1";
+		int id = get_id_attribute("id"),
+				peer_id = get_id_attribute("peer");
+
+		// paths are needed only if the file has no ids
+		auto add_connection = [this, id, peer_id, &pad_name] {
+			if (reader.readNext() != QXmlStreamReader::Characters)
+				return;
+
+			if (id >= 0 && peer_id >= 0)
+				connections.push_back({Glib::ustring(), Glib::ustring(), id, peer_id});
+			else
+				connections.push_back({get_pad_path(pad_name), reader.text().toString().toUtf8().constData(), -1, -1});
+		};
+
+		if (!ghost_target.empty() && !pad_name.empty() && GST_IS_BIN(current_element->gobj()))
+		{
+			// created when the bin's children are loaded
+			ghost_pads.push_back({current_element, pad_name, ghost_target, id, get_id_attribute("ghost-target-id")});
+
+			if (is_linked)
+				add_connection();
 
-		if (pad_name.empty() || pad_template_name.empty() || pad_is_linked.empty())
 			return;
+		}
 
-		bool is_linked = pad_is_linked == "1";
+		if (pad_name.empty() || pad_template_name.empty() || pad_is_linked.empty())
+			return;
 
 		RefPtr<PadTemplate> pad_template = current_element->get_pad_template(pad_template_name);
 
-		if (!current_element->get_static_pad(pad_name))
+		if (!pad_template)
+			return;
+
+		RefPtr<Pad> pad = current_element->get_static_pad(pad_name);
+
+		if (!pad)
 		{
-			AddCommand cmd(ObjectType::PAD, current_element,
-					pad_template); // todo and what about pad name?
-			cmd.run_command(listeners);
+			// a requested pad may get another name than the saved one, its id still refers to it
+			AddCommand cmd(ObjectType::PAD, current_element, pad_template);
+			pad = RefPtr<Pad>::cast_static(cmd.run_command_ret(listeners));
 		}
 
-		if (is_linked && pad_template->get_direction() == PAD_SRC)
-		{
-			if (reader.readNext() != QXmlStreamReader::Characters) return;
+		if (id >= 0 && pad)
+			pad_ids[id] = pad;
 
-			Glib::ustring sink_pad_text = reader.text().toString().toUtf8().constData();
-			Glib::ustring current_name = current_element->get_name() + ":" + pad_name;
-			connections[current_name] = sink_pad_text;
-		}
+		if (is_linked && pad_template->get_direction() == PAD_SRC)
+			add_connection();
 	}
 	else if (reader.name() == "future-connection")
 	{
@@ -175,8 +334,8 @@ void FileLoader::process_start_element()
 			if (source.empty() || destination.empty())
 				return;
 
-			RefPtr<Element> source_e = GstUtils::find_element(source.c_str(), model);
-			RefPtr<Element> destination_e = GstUtils::find_element(destination.c_str(), model);
+			RefPtr<Element> source_e = find_element(get_id_attribute("source-id"), source);
+			RefPtr<Element> destination_e = find_element(get_id_attribute("destination-id"), destination);
 
 			if (!source_e || !destination_e)
 				return;
@@ -193,8 +352,8 @@ void FileLoader::process_start_element()
 			if (template_parent.empty() || tpl.empty() || destination.empty())
 				return;
 
-			RefPtr<Pad> dest_pad = GstUtils::find_pad(destination.c_str(), model);
-			RefPtr<Element> tpl_parent = GstUtils::find_element(template_parent.c_str(), model);
+			RefPtr<Pad> dest_pad = find_pad(get_id_attribute("destination-id"), destination);
+			RefPtr<Element> tpl_parent = find_element(get_id_attribute("template-parent-id"), template_parent);
 
 			if (!dest_pad || !tpl_parent)
 				return;
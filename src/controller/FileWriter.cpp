@@ -41,8 +41,12 @@ void FileWriter::save_model()
 {
 	open_file();
 
+	ids.clear();
+	assign_ids(model);
+
 	writer.writeStartDocument();
 	writer.writeStartElement("pipeline");
+	write_id("id", model);
 
 	write_single_element(model);
 	write_future_connections();
@@ -51,6 +55,31 @@ void FileWriter::save_model()
 	writer.writeEndDocument();
 }
 
+// objects are numbered in the order they are written, so links can refer to objects that come later
+void FileWriter::assign_ids(const RefPtr<Element>& element)
+{
+	ids.emplace(GST_OBJECT(element->gobj()), ids.size());
+
+	auto pads = element->iterate_pads();
+	while (pads.next())
+		ids.emplace(GST_OBJECT(pads->gobj()), ids.size());
+
+	if (GstUtils::is_container(element, model))
+	{
+		auto iterator = RefPtr<Bin>::cast_static(element)->iterate_elements();
+		while (iterator.next())
+			assign_ids(*iterator);
+	}
+}
+
+void FileWriter::write_id(const QString& attribute_name, const RefPtr<Gst::Object>& object)
+{
+	auto it = ids.find(object->gobj());
+
+	if (it != ids.end())
+		writer.writeAttribute(attribute_name, QString::number(it->second));
+}
+
 void FileWriter::write_single_element(const Glib::RefPtr<Gst::Element>& element)
 {
 	guint property_count;
@@ -60,33 +89,53 @@ void FileWriter::write_single_element(const Glib::RefPtr<Gst::Element>& element)
 
 	for (size_t i = 0; i < property_count; i++)
 	{
-		Property* property = Property::build_property(property_specs[i], element, "");
+		if (!GstUtils::is_stored_property(property_specs[i], element))
+			continue;
+
+		std::unique_ptr<Property> property(Property::build_property(property_specs[i], element, ""));
 
-		if (property == nullptr)
+		if (!property)
 			continue;
 
 		writer.writeStartElement("property");
 		writer.writeAttribute("name", property_specs[i]->name);
 		writer.writeCharacters(property->get_str_value().c_str());
 		writer.writeEndElement();
-		delete property;
 	}
 
+	g_free(property_specs);
+
 	auto pads = element->iterate_pads();
 
 	while (pads.next())
 	{
+		// links to the inside of a ghost pad are restored from its target
+		RefPtr<Pad> peer = pads->get_peer();
+		bool is_linked = peer && peer->get_parent_element();
+
 		writer.writeStartElement("pad");
 		writer.writeAttribute("name", pads->get_name().c_str());
+		write_id("id", *pads);
 		if (pads->get_pad_template())
 			writer.writeAttribute("template", pads->get_pad_template()->get_name().c_str());
-		writer.writeAttribute("is_linked", std::to_string(pads->is_linked()).c_str());
-		if (pads->is_linked())
-			writer.writeCharacters((pads->get_peer()->get_parent_element()->get_name() + ":" + pads->get_peer()->get_name()).c_str());
+		if (GST_IS_GHOST_PAD(pads->gobj()) && GstUtils::is_container(element, model))
+		{
+			RefPtr<Pad> target = RefPtr<GhostPad>::cast_static(*pads)->get_target();
+			if (target)
+			{
+				writer.writeAttribute("ghost-target", GstUtils::generate_element_path(target, model).c_str());
+				write_id("ghost-target-id", target);
+			}
+		}
+		writer.writeAttribute("is_linked", std::to_string(is_linked).c_str());
+		if (is_linked)
+			write_id("peer", peer);
+		if (is_linked)
+			writer.writeCharacters(GstUtils::generate_element_path(peer, model).c_str());
 		writer.writeEndElement();
 	}
 
-	if (GST_IS_BIN(element->gobj()) && element == model) // TODO deeper search in a next version
+	if (GstUtils::is_container(element, model))
 	{
 		Glib::RefPtr<Gst::Bin> bin = bin.cast_static(element);
 		auto iterator = bin->iterate_elements();
@@ -98,8 +147,13 @@ void FileWriter::write_single_element(const Glib::RefPtr<Gst::Element>& element)
 			writer.writeStartElement("element");
 			writer.writeAttribute("factory", iterator->get_factory()->get_name().c_str());
 			writer.writeAttribute("name", iterator->get_name().c_str());
-			writer.writeAttribute("X", QString::number(finder(*iterator).rx()));
-			writer.writeAttribute("Y", QString::number(finder(*iterator).ry()));
+			write_id("id", *iterator);
+			if (element == model)
+			{
+				QPointF location = finder(*iterator);
+				writer.writeAttribute("X", QString::number(location.x()));
+				writer.writeAttribute("Y", QString::number(location.y()));
+			}
 			write_single_element(*iterator);
 			writer.writeEndElement();
 		}
@@ -110,22 +164,28 @@ void FileWriter::write_single_element(const Glib::RefPtr<Gst::Element>& element)
 
 void FileWriter::write_future_connections()
 {
-	for (auto connection_element : ConnectCommand::get_future_connections_element())
+	auto& table = FutureConnectionTable::get(model);
+
+	for (auto connection_element : table.get_element_connections())
 	{
 		writer.writeStartElement("future-connection");
 		writer.writeAttribute("type", "element");
 		writer.writeAttribute("source", GstUtils::generate_element_path(connection_element.first, model).c_str());
 		writer.writeAttribute("destination", GstUtils::generate_element_path(connection_element.second, model).c_str());
+		write_id("source-id", connection_element.first);
+		write_id("destination-id", connection_element.second);
 		writer.writeEndElement();
 	}
 
-	for (auto connection_pad : ConnectCommand::get_future_connections_pads())
+	for (auto connection_pad : table.get_pad_connections())
 	{
 		writer.writeStartElement("future-connection");
 		writer.writeAttribute("type", "pad");
 		writer.writeAttribute("template-parent", GstUtils::generate_element_path(connection_pad.first.first, model).c_str());
 		writer.writeAttribute("template", connection_pad.first.second->get_name().c_str());
 		writer.writeAttribute("destination", GstUtils::generate_element_path(connection_pad.second, model).c_str());
+		write_id("template-parent-id", connection_pad.first.first);
+		write_id("destination-id", connection_pad.second);
 		writer.writeEndElement();
 	}
 }
@@ -15,6 +15,8 @@ using namespace Gst;
 MainController::MainController(const RefPtr<Pipeline>& model)
 : model(model),
   model_modified_state(false),
+  bulk_update_depth(0),
+  modified_state_pending(false),
   main_view(nullptr)
 {
 	model->signal_element_added().connect([this](const Glib::RefPtr<Gst::Element>& e) {
@@ -59,6 +61,12 @@ void MainController::reset_modified_state()
 
 void MainController::set_modified_state()
 {
+	if (bulk_update_depth > 0)
+	{
+		modified_state_pending = true;
+		return;
+	}
+
 	Gst::State state, pending;
 	model->get_state(state, pending, 0);
 
@@ -69,13 +77,53 @@ void MainController::set_modified_state()
 		main_view->modified_state_changed(model_modified_state);
 }
 
+void MainController::bulk_update_started()
+{
+	bulk_update_depth++;
+}
+
+void MainController::bulk_update_finished()
+{
+	if (--bulk_update_depth > 0 || !modified_state_pending)
+		return;
+
+	modified_state_pending = false;
+	set_modified_state();
+}
+
 bool MainController::get_modified_state() const
 {
 	return model_modified_state;
 }
 
+void MainController::command_executed(const std::shared_ptr<Command>& command)
+{
+	if (command->get_type() == CommandType::STATE)
+		return;
+
+	// commands without an inverse (e.g. opening a property window) don't modify the model
+	if (command->is_reversible())
+		undo_stack.push(command);
+}
+
+void MainController::undo(std::vector<CommandListener*> listeners)
+{
+	undo_stack.undo(listeners);
+}
+
+void MainController::redo(std::vector<CommandListener*> listeners)
+{
+	undo_stack.redo(listeners);
+}
+
+void MainController::clear_history()
+{
+	undo_stack.clear();
+}
+
 void MainController::clean_model()
 {
+	clear_history();
 	GstUtils::clean_model(model);
 }
 
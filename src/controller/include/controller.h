@@ -10,6 +10,9 @@
 
 #include "controller/FileWriter.h"
 #include "controller/FileLoader.h"
+#include "controller/BinaryProject.h"
+#include "controller/BinaryFileWriter.h"
+#include "controller/BinaryFileLoader.h"
 #include "controller/MainController.h"
 #include "controller/CodeGenerator.h"
 #include "controller/PluginWizard/PluginCodeGenerator.h"
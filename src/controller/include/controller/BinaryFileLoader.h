@@ -0,0 +1,44 @@
+/*
+ * BinaryFileLoader.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef BINARYFILELOADER_H_
+#define BINARYFILELOADER_H_
+
+#include "BinaryProject.h"
+#include "FileLoader.h"
+#include <gstreamermm.h>
+#include <QtCore>
+#include <vector>
+
+/*
+ * Loads a binary project. The file is memory-mapped and its records are
+ * read in place, without parsing.
+ */
+class BinaryFileLoader
+{
+private:
+	std::string filename;
+	Glib::RefPtr<Gst::Pipeline> model;
+	FileLoader::position_setter pos_setter;
+	QFile file;
+	const uchar* data;
+	qint64 size;
+
+	template<typename T>
+	const T* get_section(const BinaryProject::Section& section) const;
+	const char* get_string(uint32_t index) const;
+
+	void map_file();
+	void set_property(const Glib::RefPtr<Gst::Element>& element, const BinaryProject::Property& record);
+
+public:
+	BinaryFileLoader(const std::string& filename, const Glib::RefPtr<Gst::Pipeline>& model, FileLoader::position_setter pos_setter);
+
+	void load_model(std::vector<CommandListener*> listeners);
+};
+
+#endif /* BINARYFILELOADER_H_ */
@@ -0,0 +1,54 @@
+/*
+ * BinaryFileWriter.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef BINARYFILEWRITER_H_
+#define BINARYFILEWRITER_H_
+
+#include "BinaryProject.h"
+#include "FileWriter.h"
+#include <gstreamermm.h>
+#include <unordered_map>
+#include <string>
+#include <vector>
+
+class BinaryFileWriter
+{
+private:
+	std::string filename;
+	Glib::RefPtr<Gst::Pipeline> model;
+	FileWriter::find_block finder;
+
+	std::vector<BinaryProject::String> strings;
+	std::string string_data;
+	std::unordered_map<std::string, uint32_t> string_indices;
+	std::vector<BinaryProject::Element> elements;
+	std::vector<BinaryProject::Property> properties;
+	std::vector<BinaryProject::Pad> pads;
+	std::vector<BinaryProject::Link> links;
+	std::vector<BinaryProject::FutureConnection> future_connections;
+	std::vector<Glib::RefPtr<Gst::Element>> element_objects;
+	std::unordered_map<GstElement*, uint32_t> element_indices;
+	std::unordered_map<GstPad*, uint32_t> pad_indices;
+	std::vector<std::pair<uint32_t, Glib::RefPtr<Gst::Pad>>> ghost_targets;
+
+	uint32_t add_string(const std::string& text);
+	uint32_t find_element(const Glib::RefPtr<Gst::Element>& element) const;
+	uint32_t find_pad(const Glib::RefPtr<Gst::Pad>& pad) const;
+	void add_element(const Glib::RefPtr<Gst::Element>& element, uint32_t parent);
+	void add_properties(const Glib::RefPtr<Gst::Element>& element, uint32_t index);
+	void add_pads(const Glib::RefPtr<Gst::Element>& element, uint32_t index);
+	void resolve_ghost_targets();
+	void add_links();
+	void add_future_connections();
+
+public:
+	BinaryFileWriter(const std::string& filename, const Glib::RefPtr<Gst::Pipeline>& model, FileWriter::find_block finder);
+
+	void save_model();
+};
+
+#endif /* BINARYFILEWRITER_H_ */
@@ -0,0 +1,146 @@
+/*
+ * BinaryProject.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef BINARYPROJECT_H_
+#define BINARYPROJECT_H_
+
+#include <glib-object.h>
+#include <cstdint>
+#include <string>
+
+/*
+ * Layout of the binary project file (.gstcb). The file is a header followed
+ * by flat arrays of fixed-size records in native byte order, each section
+ * aligned to 8 bytes. Names are indices into the string table; strings are
+ * NUL-terminated, so they can be used directly from the mapped file.
+ */
+struct BinaryProject
+{
+	static constexpr uint32_t magic = 0x42435347; // "GSCB"
+	static constexpr uint32_t version = 2;
+	static constexpr uint32_t none = UINT32_MAX;
+
+	struct Section
+	{
+		uint32_t offset;
+		uint32_t count;
+	};
+
+	struct Header
+	{
+		uint32_t magic;
+		uint32_t version;
+		Section strings;
+		Section string_data;
+		Section elements;
+		Section properties;
+		Section pads;
+		Section links;
+		Section future_connections;
+	};
+
+	struct String
+	{
+		uint32_t offset;
+		uint32_t length;
+	};
+
+	// parents are stored before their children; parent is `none` for the pipeline's children
+	struct Element
+	{
+		uint32_t name;
+		uint32_t factory;
+		uint32_t parent;
+		uint32_t has_location;
+		double x;
+		double y;
+	};
+
+	enum class ValueKind : uint32_t
+	{
+		BOOLEAN,
+		INT,
+		UINT,
+		LONG,
+		ULONG,
+		INT64,
+		UINT64,
+		FLOAT,
+		DOUBLE,
+		ENUM,
+		SERIALIZED
+	};
+
+	// element is `none` for the properties of the pipeline
+	struct Property
+	{
+		uint32_t element;
+		uint32_t name;
+		ValueKind kind;
+		uint32_t string_value;
+		union
+		{
+			int64_t int_value;
+			uint64_t uint_value;
+			double double_value;
+		};
+	};
+
+	// ghost_target is the index of the target's pad record, or `none` for other pads
+	struct Pad
+	{
+		uint32_t element;
+		uint32_t name;
+		uint32_t pad_template;
+		uint32_t ghost_target;
+	};
+
+	// pads are referenced by their record indices, so requested pads which get
+	// other names when they are recreated keep their links
+	struct Link
+	{
+		uint32_t src_pad;
+		uint32_t sink_pad;
+	};
+
+	// sink_pad is a pad record index, or `none` for element connections
+	struct FutureConnection
+	{
+		uint32_t src_element;
+		uint32_t pad_template;
+		uint32_t sink_element;
+		uint32_t sink_pad;
+	};
+
+	static ValueKind get_value_kind(GType type)
+	{
+		switch (G_TYPE_FUNDAMENTAL(type))
+		{
+		case G_TYPE_BOOLEAN: return ValueKind::BOOLEAN;
+		case G_TYPE_INT: return ValueKind::INT;
+		case G_TYPE_UINT: return ValueKind::UINT;
+		case G_TYPE_LONG: return ValueKind::LONG;
+		case G_TYPE_ULONG: return ValueKind::ULONG;
+		case G_TYPE_INT64: return ValueKind::INT64;
+		case G_TYPE_UINT64: return ValueKind::UINT64;
+		case G_TYPE_FLOAT: return ValueKind::FLOAT;
+		case G_TYPE_DOUBLE: return ValueKind::DOUBLE;
+		case G_TYPE_ENUM: return ValueKind::ENUM;
+		default: return ValueKind::SERIALIZED;
+		}
+	}
+
+	static bool is_binary_file(const std::string& filename)
+	{
+		static const std::string extension = ".gstcb";
+
+		return filename.size() >= extension.size() &&
+				filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0;
+	}
+};
+
+#endif /* BINARYPROJECT_H_ */
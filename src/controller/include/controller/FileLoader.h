@@ -12,6 +12,7 @@
 #include <gstreamermm.h>
 #include <QtCore>
 #include <functional>
+#include <unordered_map>
 #include "Commands.h"
 
 class FileLoader
@@ -19,19 +20,47 @@ class FileLoader
 public:
 	typedef std::function<void(const Glib::RefPtr<Gst::Element>&, double, double)> position_setter;
 private:
+	struct GhostPadInfo
+	{
+		Glib::RefPtr<Gst::Element> bin;
+		Glib::ustring name;
+		Glib::ustring target;
+		int id;
+		int target_id;
+	};
+
+	struct LinkInfo
+	{
+		Glib::ustring src;
+		Glib::ustring sink;
+		int src_id;
+		int sink_id;
+	};
+
 	QXmlStreamReader reader;
 	std::string filename;
 	Glib::RefPtr<Gst::Pipeline> model;
 	Glib::RefPtr<Gst::Element> current_element;
 	std::stack<Glib::RefPtr<Gst::Element>> element_stack;
-	std::map<Glib::ustring, Glib::ustring> connections;
+	std::vector<LinkInfo> connections;
+	std::unordered_map<int, Glib::RefPtr<Gst::Element>> element_ids;
+	std::unordered_map<int, Glib::RefPtr<Gst::Pad>> pad_ids;
+	std::vector<GhostPadInfo> ghost_pads;
+	std::vector<Glib::RefPtr<Gst::Element>> created_elements;
+	size_t next_element;
 	std::vector<CommandListener*> listeners;
 	QFile* file;
 	position_setter pos_setter;
 
 	Glib::ustring get_attribute(const char* attribute_name);
+	int get_id_attribute(const char* attribute_name);
+	Glib::ustring get_pad_path(const Glib::ustring& pad_name);
+	Glib::RefPtr<Gst::Element> find_element(int id, const Glib::ustring& path);
+	Glib::RefPtr<Gst::Pad> find_pad(int id, const Glib::ustring& path);
 	void open_file();
+	void create_elements();
 	void process_start_element();
+	void create_ghost_pads(const Glib::RefPtr<Gst::Element>& bin);
 public:
 	FileLoader(const std::string& filename, const Glib::RefPtr<Gst::Pipeline>& model, position_setter pos_setter);
 	~FileLoader();
@@ -11,6 +11,7 @@
 #include <gstreamermm.h>
 #include <QtCore>
 #include <functional>
+#include <unordered_map>
 
 class FileWriter
 {
@@ -22,7 +23,10 @@ private:
 	QXmlStreamWriter writer;
 	QFile* file;
 	find_block finder;
+	std::unordered_map<GstObject*, int> ids;
 
+	void assign_ids(const Glib::RefPtr<Gst::Element>& element);
+	void write_id(const QString& attribute_name, const Glib::RefPtr<Gst::Object>& object);
 	void write_single_element(const Glib::RefPtr<Gst::Element>& element);
 	void write_future_connections();
 	void open_file();
@@ -9,6 +9,7 @@
 #define MAINCONTROLLER_H_
 
 #include "Commands/CommandListener.h"
+#include "Commands/UndoStack.h"
 #include <gstreamermm.h>
 #include <string>
 
@@ -20,7 +21,10 @@ private:
 	Glib::RefPtr<Gst::Pipeline> model;
 	std::string current_project_file;
 	bool model_modified_state;
+	int bulk_update_depth;
+	bool modified_state_pending;
 	MainWindow* main_view;
+	UndoStack undo_stack;
 
 	void set_modified_state();
 
@@ -51,6 +55,13 @@ public:
 	{set_modified_state();}
 	void future_connection_removed(const ConnectCommand::future_connection_pads& conn)
 	{set_modified_state();}
+	void bulk_update_started();
+	void bulk_update_finished();
+	void command_executed(const std::shared_ptr<Command>& command);
+
+	void undo(std::vector<CommandListener*> listeners);
+	void redo(std::vector<CommandListener*> listeners);
+	void clear_history();
 
 	void clean_model();
 };
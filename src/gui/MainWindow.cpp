@@ -9,6 +9,7 @@
 #include "ObjectInspector/ObjectInspectorModel.h"
 #include "ObjectInspector/ObjectInspectorFilter.h"
 #include <QtWidgets/qmessagebox.h>
+#include <QShortcut>
 #include <gstreamermm.h>
 
 MainWindow::MainWindow(MainController* controller, QWidget *parent)
@@ -36,6 +37,28 @@ MainWindow::MainWindow(MainController* controller, QWidget *parent)
 	QObject::connect(ui->pausedRadioButton, &QRadioButton::clicked, this, &MainWindow::pipeline_state_paused);
 	QObject::connect(ui->stoppedRadioButton, &QRadioButton::clicked, this, &MainWindow::pipeline_state_stopped);
 	QObject::connect(ui->playingRadioButton, &QRadioButton::clicked, this, &MainWindow::pipeline_state_playing);
+
+	QObject::connect(new QShortcut(QKeySequence::Undo, this), &QShortcut::activated, [this] {
+		try
+		{
+			this->controller->undo({workspace, this->controller});
+		}
+		catch (const std::exception& ex)
+		{
+			show_error_box(QString("Cannot undo: ") + ex.what());
+		}
+	});
+
+	QObject::connect(new QShortcut(QKeySequence::Redo, this), &QShortcut::activated, [this] {
+		try
+		{
+			this->controller->redo({workspace, this->controller});
+		}
+		catch (const std::exception& ex)
+		{
+			show_error_box(QString("Cannot redo: ") + ex.what());
+		}
+	});
 }
 
 void MainWindow::reload_plugins()
@@ -132,14 +155,15 @@ void MainWindow::on_actionAbout_triggered(bool checked)
 
 bool MainWindow::save_project_dialog()
 {
+	QString selected_filter;
 	QString filename = QFileDialog::getSaveFileName(this, "Save Project", QDir::currentPath(),
-			"gst-creator files (*.gstc);;All files (*.*)", 0, QFileDialog::DontUseNativeDialog);
+			"gst-creator files (*.gstc);;gst-creator binary files (*.gstcb);;All files (*.*)", &selected_filter, QFileDialog::DontUseNativeDialog);
 
 	if (filename.isNull())
 		return false;
 
-	if (!filename.endsWith(".gstc", Qt::CaseInsensitive))
-			filename += ".gstc";
+	if (!filename.endsWith(".gstc", Qt::CaseInsensitive) && !filename.endsWith(".gstcb", Qt::CaseInsensitive))
+		filename += selected_filter.contains("*.gstcb") ? ".gstcb" : ".gstc";
 
 	controller->set_current_project_file(filename.toUtf8().constData());
 
@@ -150,9 +174,12 @@ void MainWindow::save_project()
 {
 	try
 	{
-		FileWriter(controller->get_current_project_file(), controller->get_model(),
-				std::bind(&WorkspaceWidget::get_block_location, workspace, std::placeholders::_1))
-									.save_model();
+		auto finder = std::bind(&WorkspaceWidget::get_block_location, workspace, std::placeholders::_1);
+
+		if (BinaryProject::is_binary_file(controller->get_current_project_file()))
+			BinaryFileWriter(controller->get_current_project_file(), controller->get_model(), finder).save_model();
+		else
+			FileWriter(controller->get_current_project_file(), controller->get_model(), finder).save_model();
 
 		controller->reset_modified_state();
 	}
@@ -193,16 +220,29 @@ void MainWindow::on_actionLoad_triggered(bool checked)
 	}
 
 	QString filename = QFileDialog::getOpenFileName(this, "Open Project", QDir::currentPath(),
-			"gst-creator files (*.gstc);;All files (*.*)", 0, QFileDialog::DontUseNativeDialog);
+			"gst-creator files (*.gstc);;gst-creator binary files (*.gstcb);;All files (*.*)", 0, QFileDialog::DontUseNativeDialog);
 
 	if (filename.isNull())
 		return;
 
-	FileLoader(filename.toUtf8().constData(), controller->get_model(),
-			std::bind(&WorkspaceWidget::set_block_location, workspace,
-					std::placeholders::_1, std::placeholders::_2, std::placeholders::_3))
-	.load_model({workspace});
+	std::string project_file = filename.toUtf8().constData();
+	auto pos_setter = std::bind(&WorkspaceWidget::set_block_location, workspace,
+			std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+
+	try
+	{
+		if (BinaryProject::is_binary_file(project_file))
+			BinaryFileLoader(project_file, controller->get_model(), pos_setter).load_model({workspace});
+		else
+			FileLoader(project_file, controller->get_model(), pos_setter).load_model({workspace});
+	}
+	catch (const std::exception& ex)
+	{
+		show_error_box(QString("Cannot load project: ") + ex.what());
+		return;
+	}
 
+	controller->clear_history();
 	controller->reset_modified_state();
 	controller->set_current_project_file(filename.toStdString());
 }
@@ -1,10 +1,12 @@
 #include "gui/MainWindow.h"
 #include "controller/MainController.h"
+#include "utils/LinkMatrix.h"
 #include <QApplication>
 
 int main(int argc, char *argv[])
 {
 	Gst::init(argc, argv);
+	LinkMatrix::build_async();
 	QApplication a(argc, argv);
 	Glib::RefPtr<Gst::Pipeline> model = Gst::Pipeline::create("main-pipeline");
 	MainController controller(model);
@@ -12,5 +14,8 @@ int main(int argc, char *argv[])
 	controller.set_main_view(&w);
 	w.show();
 
-	return a.exec();
+	int result = a.exec();
+	LinkMatrix::stop();
+
+	return result;
 }
@@ -35,10 +35,16 @@ class QNEBlock : public QGraphicsPathItem
 {
 public:
 	enum { Type = QGraphicsItem::UserType + 3 };
+	// below this zoom level port labels are hidden and connections are drawn as straight lines
+	static constexpr qreal detailThreshold = 0.6;
 
 	QNEBlock(const Glib::RefPtr<Gst::Element>& model, QGraphicsItem *parent = 0);
 
 	QNEPort* addPort(const Glib::RefPtr<Gst::Object>& model, bool isOutput, int flags = 0, int ptr = 0);
+	void setLayoutDeferred(bool deferred);
+	void relayout();
+	void setHeat(qreal heat);
+	void setFillLevel(qreal level);
 	void addInputPort(const Glib::RefPtr<Gst::Object>& model);
 	void addOutputPort(const Glib::RefPtr<Gst::Object>& model);
 	void save(QDataStream&);
@@ -59,6 +65,9 @@ private:
 	int vertMargin;
 	int width;
 	int height;
+	bool layoutDeferred;
+	qreal heat;
+	qreal fillLevel;
 	Glib::RefPtr<Gst::Element> model;
 };
 
@@ -27,6 +27,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 #define QNECONNECTION_H
 
 #include <QGraphicsPathItem>
+#include <QSet>
+#include <QPointer>
+#include <QTimer>
+
+class QGraphicsSimpleTextItem;
 
 class QNEPort;
 
@@ -44,19 +49,29 @@ public:
 	void setPort2(QNEPort *p);
 	void updatePosFromPorts();
 	void updatePath();
+	void scheduleUpdate();
+	static void flushUpdates();
 	QNEPort* port1() const;
 	QNEPort* port2() const;
 	void connectColor(int status);
+	void setInfo(const QString &text);
 	void save(QDataStream&);
 	void load(QDataStream&, const QMap<quint64, QNEPort*> &portMap);
 
 	int type() const { return Type; }
 
+protected:
+	void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
+
 private:
 	QPointF pos1;
 	QPointF pos2;
 	QNEPort *m_port1;
 	QNEPort *m_port2;
+	QGraphicsSimpleTextItem *info;
+
+	static QSet<QNEConnection*> dirtyConnections;
+	static QPointer<QTimer> flushTimer;
 };
 
 #endif // QNECONNECTION_H
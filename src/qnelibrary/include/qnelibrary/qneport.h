@@ -48,6 +48,7 @@ public:
 	bool isOutput();
 	QVector<QNEConnection*>& connections();
 	void setPortFlags(int);
+	void setLabelVisible(bool visible);
 
 	const QString& portName() const { return name; }
 	int portFlags() const { return m_portFlags; }
@@ -64,6 +65,9 @@ public:
 	Glib::RefPtr<Gst::Object> get_object_model() { return model; }
 	bool is_template_model() { return GST_IS_PAD_TEMPLATE(model->gobj()); }
 	bool can_link(QNEPort* sink_port) const;
+	// doesn't touch graphics items, so it can be called from any thread
+	static bool can_link(const Glib::RefPtr<Gst::Element>& src_parent, const Glib::RefPtr<Gst::Object>& src_model,
+			const Glib::RefPtr<Gst::Element>& sink_parent, const Glib::RefPtr<Gst::Object>& sink_model);
 
 protected:
 	QVariant itemChange(GraphicsItemChange change, const QVariant &value);
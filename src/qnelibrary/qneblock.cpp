@@ -32,6 +32,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 
 #include "qneport.h"
 
+constexpr qreal QNEBlock::detailThreshold;
+
 QNEBlock::QNEBlock(const Glib::RefPtr<Gst::Element>& model, QGraphicsItem *parent)
 : QGraphicsPathItem(parent),
   model(model)
@@ -43,10 +45,14 @@ QNEBlock::QNEBlock(const Glib::RefPtr<Gst::Element>& model, QGraphicsItem *paren
 	setBrush(Qt::green);
 	setFlag(QGraphicsItem::ItemIsMovable);
 	setFlag(QGraphicsItem::ItemIsSelectable);
+	setCacheMode(QGraphicsItem::DeviceCoordinateCache);
 	horzMargin = 20;
 	vertMargin = 5;
 	width = horzMargin;
 	height = vertMargin;
+	layoutDeferred = false;
+	heat = -1;
+	fillLevel = -1;
 }
 
 QNEPort* QNEBlock::addPort(const Glib::RefPtr<Gst::Object>& model, bool isOutput, int flags, int ptr)
@@ -60,32 +66,70 @@ QNEPort* QNEBlock::addPort(const Glib::RefPtr<Gst::Object>& model, bool isOutput
 	port->setPortFlags(flags);
 	port->setPtr(ptr);
 
+	if (!layoutDeferred)
+		relayout();
+
+	return port;
+}
+
+void QNEBlock::setLayoutDeferred(bool deferred)
+{
+	layoutDeferred = deferred;
+
+	if (!layoutDeferred)
+		relayout();
+}
+
+void QNEBlock::setHeat(qreal h)
+{
+	if (h == heat)
+		return;
+
+	heat = h;
+	update();
+}
+
+void QNEBlock::setFillLevel(qreal level)
+{
+	if (level == fillLevel)
+		return;
+
+	fillLevel = level;
+	update();
+}
+
+void QNEBlock::relayout()
+{
 	QFontMetrics fm(scene()->font());
-	int w = fm.width(port_name.c_str());
 	int h = fm.height();
-	// port->setPos(0, height + h/2);
-	if (w > width - horzMargin)
-		width = w + horzMargin;
-	height += h;
+
+	width = horzMargin;
+	height = vertMargin;
+
+	QVector<QNEPort*> block_ports = ports();
+
+	Q_FOREACH(QNEPort *port, block_ports) {
+		int w = fm.width(port->portName());
+		if (w > width - horzMargin)
+			width = w + horzMargin;
+		height += h;
+	}
 
 	QPainterPath p;
 	p.addRoundedRect(-width/2, -height/2, width, height, 5, 5);
 	setPath(p);
 
-	int y = -height / 2 + vertMargin + port->radius();
-	Q_FOREACH(QGraphicsItem *port_, childItems()) {
-		if (port_->type() != QNEPort::Type)
-			continue;
+	if (block_ports.isEmpty())
+		return;
 
-		QNEPort *port = (QNEPort*) port_;
+	int y = -height / 2 + vertMargin + block_ports.first()->radius();
+	Q_FOREACH(QNEPort *port, block_ports) {
 		if (port->isOutput())
 			port->setPos(width/2 + port->radius(), y);
 		else
 			port->setPos(-width/2 - port->radius(), y);
 		y += h;
 	}
-
-	return port;
 }
 
 void QNEBlock::addInputPort(const Glib::RefPtr<Gst::Object>& model)
@@ -153,18 +197,35 @@ void QNEBlock::load(QDataStream &ds, QMap<quint64, QNEPort*> &portMap)
 
 void QNEBlock::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-	Q_UNUSED(option)
-							Q_UNUSED(widget)
-
-							if (isSelected()) {
-								painter->setPen(QPen(Qt::darkYellow));
-								painter->setBrush(Qt::yellow);
-							} else {
-								painter->setPen(QPen(Qt::darkGreen));
-								painter->setBrush(Qt::green);
-							}
-
-	painter->drawPath(path());
+	Q_UNUSED(widget)
+
+	if (isSelected()) {
+		painter->setPen(QPen(Qt::darkYellow));
+		painter->setBrush(Qt::yellow);
+	} else if (heat >= 0) {
+		// from green (cheap) to red (most expensive element)
+		QColor color = QColor::fromHsvF((1 - qBound(0.0, heat, 1.0)) / 3, 0.8, 0.9);
+		painter->setPen(QPen(color.darker()));
+		painter->setBrush(color);
+	} else {
+		painter->setPen(QPen(Qt::darkGreen));
+		painter->setBrush(Qt::green);
+	}
+
+	if (option->levelOfDetailFromTransform(painter->worldTransform()) < detailThreshold)
+		painter->drawRect(-width/2, -height/2, width, height);
+	else
+		painter->drawPath(path());
+
+	if (fillLevel >= 0) {
+		QRectF bar(-width/2 + 4, height/2 - 6, width - 8, 4);
+		painter->setPen(Qt::NoPen);
+		painter->setBrush(Qt::white);
+		painter->drawRect(bar);
+		bar.setWidth(bar.width() * qBound(0.0, fillLevel, 1.0));
+		painter->setBrush(fillLevel >= 0.9 ? Qt::red : (fillLevel <= 0.1 ? Qt::blue : Qt::darkGreen));
+		painter->drawRect(bar);
+	}
 }
 
 QNEBlock* QNEBlock::clone()
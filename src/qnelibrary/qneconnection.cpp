@@ -26,10 +26,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 #include "qneconnection.h"
 
 #include "qneport.h"
+#include "qneblock.h"
 
 #include <QBrush>
 #include <QPen>
 #include <QGraphicsScene>
+#include <QCoreApplication>
+#include <QTimer>
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+#include <QGraphicsSimpleTextItem>
+
+QSet<QNEConnection*> QNEConnection::dirtyConnections;
+QPointer<QTimer> QNEConnection::flushTimer;
 
 QNEConnection::QNEConnection(QGraphicsItem *parent) : QGraphicsPathItem(parent)
 {
@@ -38,10 +47,13 @@ QNEConnection::QNEConnection(QGraphicsItem *parent) : QGraphicsPathItem(parent)
 	setZValue(-1);
 	m_port1 = 0;
 	m_port2 = 0;
+	info = 0;
 }
 
 QNEConnection::~QNEConnection()
 {
+	dirtyConnections.remove(this);
+
 	if (m_port1)
 		m_port1->connections().remove(m_port1->connections().indexOf(this));
 	if (m_port2)
@@ -96,6 +108,78 @@ void QNEConnection::updatePath()
 	p.cubicTo(ctr1, ctr2, pos2);
 
 	setPath(p);
+
+	if (info)
+		info->setPos(p.pointAtPercent(0.5) - QPointF(info->boundingRect().width() / 2, info->boundingRect().height()));
+}
+
+void QNEConnection::setInfo(const QString &text)
+{
+	if (text.isEmpty())
+	{
+		delete info;
+		info = 0;
+		return;
+	}
+
+	if (!info)
+	{
+		info = new QGraphicsSimpleTextItem(this);
+		info->setBrush(Qt::darkBlue);
+	}
+
+	info->setText(text);
+	info->setPos(path().pointAtPercent(0.5) - QPointF(info->boundingRect().width() / 2, info->boundingRect().height()));
+}
+
+void QNEConnection::scheduleUpdate()
+{
+	// no event loop is left to process the update while the application shuts down
+	if (!QCoreApplication::instance() || QCoreApplication::closingDown())
+		return;
+
+	// geometry of all moved connections is recomputed once, after pending events are processed
+	dirtyConnections.insert(this);
+
+	if (flushTimer.isNull())
+	{
+		// the application owns the timer, so it outlives every scene but not the event loop
+		flushTimer = new QTimer(QCoreApplication::instance());
+		flushTimer->setSingleShot(true);
+		flushTimer->setInterval(0);
+		QObject::connect(flushTimer, &QTimer::timeout, &QNEConnection::flushUpdates);
+	}
+
+	if (!flushTimer->isActive())
+		flushTimer->start();
+}
+
+void QNEConnection::flushUpdates()
+{
+	QSet<QNEConnection*> connections;
+	connections.swap(dirtyConnections);
+
+	Q_FOREACH(QNEConnection *conn, connections)
+	{
+		if (!conn->m_port1 || !conn->m_port2)
+			continue;
+
+		conn->updatePosFromPorts();
+		conn->updatePath();
+	}
+}
+
+void QNEConnection::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+{
+	if (option->levelOfDetailFromTransform(painter->worldTransform()) >= QNEBlock::detailThreshold)
+	{
+		QGraphicsPathItem::paint(painter, option, widget);
+		return;
+	}
+
+	painter->setPen(pen());
+	painter->setRenderHint(QPainter::Antialiasing, false);
+	painter->drawLine(pos1, pos2);
 }
 
 QNEPort* QNEConnection::port1() const
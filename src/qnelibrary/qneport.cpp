@@ -33,12 +33,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 #include "qneconnection.h"
 #include "qneblock.h"
 #include "utils/GstUtils.h"
+#include "utils/CapsCompatibilityCache.h"
 
 QNEPort::QNEPort(const Glib::RefPtr<Gst::Object>& model, QGraphicsItem *parent)
 : QGraphicsPathItem(parent),
   model(model)
 {
 	label = new QGraphicsTextItem(this);
+	label->setCacheMode(QGraphicsItem::DeviceCoordinateCache);
 
 	radius_ = 5;
 	margin = 2;
@@ -118,6 +120,11 @@ void QNEPort::setPortFlags(int f)
 	}
 }
 
+void QNEPort::setLabelVisible(bool visible)
+{
+	label->setVisible(visible);
+}
+
 QNEBlock* QNEPort::block() const
 {
 	return m_block;
@@ -147,23 +154,22 @@ QVariant QNEPort::itemChange(GraphicsItemChange change, const QVariant &value)
 	if (change == ItemScenePositionHasChanged)
 	{
 		Q_FOREACH(QNEConnection *conn, m_connections)
-										{
-			conn->updatePosFromPorts();
-			conn->updatePath();
-										}
+			conn->scheduleUpdate();
 	}
 	return value;
 }
 
 bool QNEPort::can_link(QNEPort* sink_port) const
 {
-	auto sink_model = sink_port->get_object_model();
-
 	if (isOutput_ == sink_port->isOutput_)
 		return false;
-	auto m1 = block()->get_model();
-	auto m2 = sink_port->block()->get_model();
 
+	return can_link(block()->get_model(), model, sink_port->block()->get_model(), sink_port->get_object_model());
+}
+
+bool QNEPort::can_link(const Glib::RefPtr<Gst::Element>& m1, const Glib::RefPtr<Gst::Object>& model,
+		const Glib::RefPtr<Gst::Element>& m2, const Glib::RefPtr<Gst::Object>& sink_model)
+{
 	if (!model && !sink_model)
 		return GstUtils::find_connection(m1, m2).exists;
 
@@ -178,15 +184,15 @@ bool QNEPort::can_link(QNEPort* sink_port) const
 				Glib::RefPtr<Gst::Pad>::cast_static(sink_model));
 
 	if (GST_IS_PAD_TEMPLATE(model->gobj()) && GST_IS_PAD_TEMPLATE(sink_model->gobj()))
-		return Gst::Pad::create(Glib::RefPtr<Gst::PadTemplate>::cast_static(model))->can_link(
-				Gst::Pad::create(Glib::RefPtr<Gst::PadTemplate>::cast_static(sink_model)));
+		return CapsCompatibilityCache::can_link(Glib::RefPtr<Gst::PadTemplate>::cast_static(model),
+				Glib::RefPtr<Gst::PadTemplate>::cast_static(sink_model));
 
 	if (GST_IS_PAD_TEMPLATE(model->gobj()) && GST_IS_PAD(sink_model->gobj()))
-		return Gst::Pad::create(Glib::RefPtr<Gst::PadTemplate>::cast_static(model))->can_link(
+		return CapsCompatibilityCache::can_link(Glib::RefPtr<Gst::PadTemplate>::cast_static(model),
 				Glib::RefPtr<Gst::Pad>::cast_static(sink_model));
 
 	if (GST_IS_PAD(model->gobj()) && GST_IS_PAD_TEMPLATE(sink_model->gobj()))
-		return Glib::RefPtr<Gst::Pad>::cast_static(model)->can_link(
-				Gst::Pad::create(Glib::RefPtr<Gst::PadTemplate>::cast_static(sink_model)));
+		return CapsCompatibilityCache::can_link(Glib::RefPtr<Gst::Pad>::cast_static(model),
+				Glib::RefPtr<Gst::PadTemplate>::cast_static(sink_model));
 	return false;
 }
@@ -0,0 +1,189 @@
+/*
+ * AutoPlugPathFinder.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "AutoPlugPathFinder.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+
+using namespace Gst;
+using Glib::RefPtr;
+
+AutoPlugPathFinder::AutoPlugPathFinder(const std::shared_ptr<const LinkMatrix>& matrix, size_t max_depth,
+		std::chrono::milliseconds time_budget)
+: matrix(matrix),
+  max_depth(max_depth),
+  time_budget(time_budget)
+{
+	for (size_t f = 0; f < matrix->get_factory_count(); f++)
+	{
+		const LinkMatrix::FactoryInfo& factory = matrix->get_factory(f);
+
+		if (factory.src_end - factory.src_begin != 1 || factory.sink_end - factory.sink_begin != 1)
+			continue;
+
+		if (matrix->get_src_template(factory.src_begin).presence != PAD_ALWAYS ||
+				matrix->get_sink_template(factory.sink_begin).presence != PAD_ALWAYS)
+			continue;
+
+		double cost = get_cost(factory);
+
+		if (cost > 0)
+			nodes.push_back({f, factory.sink_begin, factory.src_begin, cost});
+	}
+}
+
+double AutoPlugPathFinder::get_cost(const LinkMatrix::FactoryInfo& factory)
+{
+	// pass-through elements (queue, identity, capsfilter...) accept anything,
+	// so only elements which really transform data are taken into account
+	double cost;
+
+	if (factory.klass.find("Converter") != std::string::npos)
+		cost = 1;
+	else if (factory.klass.find("Parser") != std::string::npos)
+		cost = 2;
+	else if (factory.klass.find("Decoder") != std::string::npos ||
+			factory.klass.find("Depayloader") != std::string::npos)
+		cost = 4;
+	else if (factory.klass.find("Encoder") != std::string::npos ||
+			factory.klass.find("Payloader") != std::string::npos)
+		cost = 6;
+	else
+		return 0;
+
+	guint rank = std::min<guint>(factory.rank, GST_RANK_PRIMARY);
+
+	return cost + 2.0 * (GST_RANK_PRIMARY - rank) / GST_RANK_PRIMARY;
+}
+
+std::vector<size_t> AutoPlugPathFinder::get_templates(const RefPtr<Element>& element,
+		const RefPtr<Object>& port, PadDirection direction) const
+{
+	std::vector<size_t> templates;
+	int factory = matrix->find_factory(element);
+
+	if (factory < 0)
+		return templates;
+
+	std::string name;
+
+	if (port && GST_IS_PAD(port->gobj()))
+	{
+		RefPtr<PadTemplate> tpl = RefPtr<Pad>::cast_static(port)->get_pad_template();
+		if (tpl)
+			name = tpl->get_name_template();
+	}
+	else if (port && GST_IS_PAD_TEMPLATE(port->gobj()))
+		name = RefPtr<PadTemplate>::cast_static(port)->get_name_template();
+
+	const LinkMatrix::FactoryInfo& info = matrix->get_factory(factory);
+	size_t begin = (direction == PAD_SRC) ? info.src_begin : info.sink_begin;
+	size_t end = (direction == PAD_SRC) ? info.src_end : info.sink_end;
+
+	for (size_t i = begin; i < end; i++)
+	{
+		const LinkMatrix::PadTemplateInfo& tpl = (direction == PAD_SRC) ?
+				matrix->get_src_template(i) : matrix->get_sink_template(i);
+
+		if (name.empty() || tpl.name == name)
+			templates.push_back(i);
+	}
+
+	return templates;
+}
+
+bool AutoPlugPathFinder::find_path(const std::vector<size_t>& src_templates, const std::vector<size_t>& sink_templates,
+		std::vector<size_t>& path) const
+{
+	typedef std::pair<double, size_t> queue_item;
+
+	auto deadline = std::chrono::steady_clock::now() + time_budget;
+	const size_t none = std::numeric_limits<size_t>::max();
+	std::vector<double> distance(nodes.size(), std::numeric_limits<double>::infinity());
+	std::vector<size_t> depth(nodes.size(), 0);
+	std::vector<size_t> previous(nodes.size(), none);
+	std::priority_queue<queue_item, std::vector<queue_item>, std::greater<queue_item>> queue;
+
+	for (size_t v = 0; v < nodes.size(); v++)
+	{
+		for (auto src_tpl : src_templates)
+		{
+			if (matrix->can_link_templates(src_tpl, nodes[v].sink_tpl))
+			{
+				distance[v] = nodes[v].cost;
+				depth[v] = 1;
+				queue.push(queue_item(distance[v], v));
+				break;
+			}
+		}
+	}
+
+	while (!queue.empty())
+	{
+		if (std::chrono::steady_clock::now() > deadline)
+			return false;
+
+		queue_item top = queue.top();
+		queue.pop();
+		size_t u = top.second;
+
+		if (top.first > distance[u])
+			continue;
+
+		for (auto sink_tpl : sink_templates)
+		{
+			if (!matrix->can_link_templates(nodes[u].src_tpl, sink_tpl))
+				continue;
+
+			path.clear();
+			for (size_t v = u; v != none; v = previous[v])
+				path.push_back(nodes[v].factory);
+			std::reverse(path.begin(), path.end());
+
+			return true;
+		}
+
+		if (depth[u] >= max_depth)
+			continue;
+
+		for (size_t v = 0; v < nodes.size(); v++)
+		{
+			double dist = distance[u] + nodes[v].cost;
+
+			if (dist < distance[v] && matrix->can_link_templates(nodes[u].src_tpl, nodes[v].sink_tpl))
+			{
+				distance[v] = dist;
+				depth[v] = depth[u] + 1;
+				previous[v] = u;
+				queue.push(queue_item(dist, v));
+			}
+		}
+	}
+
+	return false;
+}
+
+bool AutoPlugPathFinder::find_path(const RefPtr<Element>& source, const RefPtr<Object>& src_port,
+		const RefPtr<Element>& destination, const RefPtr<Object>& sink_port,
+		std::vector<std::string>& path) const
+{
+	std::vector<size_t> src_templates = get_templates(source, src_port, PAD_SRC);
+	std::vector<size_t> sink_templates = get_templates(destination, sink_port, PAD_SINK);
+	std::vector<size_t> factories;
+
+	if (src_templates.empty() || sink_templates.empty() ||
+			!find_path(src_templates, sink_templates, factories))
+		return false;
+
+	path.clear();
+	for (auto factory : factories)
+		path.push_back(matrix->get_factory(factory).name);
+
+	return true;
+}
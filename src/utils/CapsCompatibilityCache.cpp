@@ -0,0 +1,94 @@
+/*
+ * CapsCompatibilityCache.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "CapsCompatibilityCache.h"
+
+using namespace Gst;
+using Glib::RefPtr;
+
+std::mutex CapsCompatibilityCache::mutex;
+guint32 CapsCompatibilityCache::registry_cookie = 0;
+std::unordered_map<CapsCompatibilityCache::template_pair, bool, CapsCompatibilityCache::template_pair_hash> CapsCompatibilityCache::results;
+std::unordered_map<GstPadTemplate*, RefPtr<Pad>> CapsCompatibilityCache::template_pads;
+
+void CapsCompatibilityCache::check_registry()
+{
+	guint32 cookie = gst_registry_get_feature_list_cookie(gst_registry_get());
+
+	if (cookie == registry_cookie)
+		return;
+
+	results.clear();
+	template_pads.clear();
+	registry_cookie = cookie;
+}
+
+RefPtr<Pad> CapsCompatibilityCache::get_template_pad_unlocked(const RefPtr<PadTemplate>& tpl)
+{
+	auto it = template_pads.find(tpl->gobj());
+
+	if (it != template_pads.end())
+		return it->second;
+
+	// pad keeps a reference to its template, so template pointers used as keys stay valid
+	RefPtr<Pad> pad = Pad::create(tpl);
+	template_pads[tpl->gobj()] = pad;
+
+	return pad;
+}
+
+RefPtr<Pad> CapsCompatibilityCache::get_template_pad(const RefPtr<PadTemplate>& tpl)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	check_registry();
+
+	return get_template_pad_unlocked(tpl);
+}
+
+bool CapsCompatibilityCache::can_link(const RefPtr<PadTemplate>& src_tpl, const RefPtr<PadTemplate>& sink_tpl)
+{
+	if (!src_tpl || !sink_tpl)
+		return false;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	check_registry();
+
+	template_pair key(src_tpl->gobj(), sink_tpl->gobj());
+	auto it = results.find(key);
+
+	if (it != results.end())
+		return it->second;
+
+	bool result = get_template_pad_unlocked(src_tpl)->can_link(get_template_pad_unlocked(sink_tpl));
+	results[key] = result;
+
+	return result;
+}
+
+bool CapsCompatibilityCache::can_link(const RefPtr<Pad>& src_pad, const RefPtr<PadTemplate>& sink_tpl)
+{
+	if (!src_pad || !sink_tpl)
+		return false;
+
+	return src_pad->can_link(get_template_pad(sink_tpl));
+}
+
+bool CapsCompatibilityCache::can_link(const RefPtr<PadTemplate>& src_tpl, const RefPtr<Pad>& sink_pad)
+{
+	if (!src_tpl || !sink_pad)
+		return false;
+
+	return get_template_pad(src_tpl)->can_link(sink_pad);
+}
+
+void CapsCompatibilityCache::invalidate()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	results.clear();
+	template_pads.clear();
+}
@@ -0,0 +1,216 @@
+/*
+ * ElementPathIndex.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "ElementPathIndex.h"
+
+using namespace Gst;
+using Glib::RefPtr;
+
+static const char* index_data_key = "gst-creator-path-index";
+
+ElementPathIndex::ElementPathIndex(GstBin* root)
+: root(root),
+  revision(0)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	RefPtr<Bin> root_bin = Glib::wrap(root, true);
+
+	watch_bin(root_bin);
+
+	auto iterator = root_bin->iterate_elements();
+	while (iterator.next())
+		add_element(*iterator);
+}
+
+ElementPathIndex::~ElementPathIndex()
+{
+	for (auto& watch : watches)
+		for (auto& connection : watch.second)
+			connection.disconnect();
+}
+
+ElementPathIndex& ElementPathIndex::get(const RefPtr<Bin>& root)
+{
+	gpointer data = g_object_get_data(G_OBJECT(root->gobj()), index_data_key);
+
+	if (data != nullptr)
+		return *static_cast<ElementPathIndex*>(data);
+
+	ElementPathIndex* index = new ElementPathIndex(root->gobj());
+	g_object_set_data_full(G_OBJECT(root->gobj()), index_data_key, index, &ElementPathIndex::destroy);
+
+	return *index;
+}
+
+void ElementPathIndex::destroy(gpointer index)
+{
+	delete static_cast<ElementPathIndex*>(index);
+}
+
+std::string ElementPathIndex::child_path(GstObject* parent, const Glib::ustring& name) const
+{
+	if (parent == GST_OBJECT(root))
+		return name.raw();
+
+	auto it = paths.find(parent);
+
+	return (it == paths.end()) ? std::string() : it->second + ":" + name.raw();
+}
+
+void ElementPathIndex::add_object(GstObject* object, const std::string& path)
+{
+	(GST_IS_PAD(object) ? pad_objects : element_objects)[path] = object;
+	paths[object] = path;
+	revision++;
+}
+
+void ElementPathIndex::remove_object(GstObject* object)
+{
+	auto it = paths.find(object);
+
+	if (it == paths.end())
+		return;
+
+	auto& objects = GST_IS_PAD(object) ? pad_objects : element_objects;
+	auto obj_it = objects.find(it->second);
+	if (obj_it != objects.end() && obj_it->second == object)
+		objects.erase(obj_it);
+
+	paths.erase(it);
+	revision++;
+}
+
+void ElementPathIndex::watch_bin(const RefPtr<Bin>& bin)
+{
+	auto& connections = watches[GST_OBJECT(bin->gobj())];
+
+	connections.push_back(bin->signal_element_added().connect([this](const RefPtr<Element>& element) {
+		std::lock_guard<std::mutex> lock(mutex);
+		add_element(element);
+	}));
+	connections.push_back(bin->signal_element_removed().connect([this](const RefPtr<Element>& element) {
+		std::lock_guard<std::mutex> lock(mutex);
+		remove_element(element);
+	}));
+}
+
+void ElementPathIndex::watch_element(const RefPtr<Element>& element)
+{
+	auto& connections = watches[GST_OBJECT(element->gobj())];
+
+	connections.push_back(element->signal_pad_added().connect([this](const RefPtr<Pad>& pad) {
+		std::lock_guard<std::mutex> lock(mutex);
+		add_pad(pad);
+	}));
+	connections.push_back(element->signal_pad_removed().connect([this](const RefPtr<Pad>& pad) {
+		std::lock_guard<std::mutex> lock(mutex);
+		remove_pad(pad);
+	}));
+
+	if (GST_IS_BIN(element->gobj()))
+		watch_bin(RefPtr<Bin>::cast_static(element));
+}
+
+void ElementPathIndex::add_element(const RefPtr<Element>& element)
+{
+	std::string path = child_path(GST_OBJECT_PARENT(element->gobj()), element->get_name());
+
+	if (path.empty())
+		return;
+
+	add_object(GST_OBJECT(element->gobj()), path);
+	watch_element(element);
+
+	auto pads = element->iterate_pads();
+	while (pads.next())
+		add_pad(*pads);
+
+	if (GST_IS_BIN(element->gobj()))
+	{
+		RefPtr<Bin> bin = RefPtr<Bin>::cast_static(element);
+		auto iterator = bin->iterate_elements();
+
+		while (iterator.next())
+			add_element(*iterator);
+	}
+}
+
+void ElementPathIndex::remove_element(const RefPtr<Element>& element)
+{
+	GstObject* object = GST_OBJECT(element->gobj());
+	auto watch = watches.find(object);
+
+	if (watch != watches.end())
+	{
+		for (auto& connection : watch->second)
+			connection.disconnect();
+		watches.erase(watch);
+	}
+
+	auto pads = element->iterate_pads();
+	while (pads.next())
+		remove_object(GST_OBJECT(pads->gobj()));
+
+	if (GST_IS_BIN(element->gobj()))
+	{
+		RefPtr<Bin> bin = RefPtr<Bin>::cast_static(element);
+		auto iterator = bin->iterate_elements();
+
+		while (iterator.next())
+			remove_element(*iterator);
+	}
+
+	remove_object(object);
+}
+
+void ElementPathIndex::add_pad(const RefPtr<Pad>& pad)
+{
+	std::string path = child_path(GST_OBJECT_PARENT(pad->gobj()), pad->get_name());
+
+	if (!path.empty())
+		add_object(GST_OBJECT(pad->gobj()), path);
+}
+
+void ElementPathIndex::remove_pad(const RefPtr<Pad>& pad)
+{
+	remove_object(GST_OBJECT(pad->gobj()));
+}
+
+RefPtr<Element> ElementPathIndex::find_element(const std::string& path) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = element_objects.find(path);
+
+	return (it == element_objects.end()) ? RefPtr<Element>() : Glib::wrap(GST_ELEMENT(it->second), true);
+}
+
+RefPtr<Pad> ElementPathIndex::find_pad(const std::string& path) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = pad_objects.find(path);
+
+	return (it == pad_objects.end()) ? RefPtr<Pad>() : Glib::wrap(GST_PAD(it->second), true);
+}
+
+bool ElementPathIndex::find_path(const RefPtr<Object>& object, std::string& path) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = paths.find(object->gobj());
+
+	if (it == paths.end())
+		return false;
+
+	path = it->second;
+	return true;
+}
+
+unsigned long ElementPathIndex::get_revision() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	return revision;
+}
@@ -0,0 +1,206 @@
+/*
+ * FutureConnectionTable.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "FutureConnectionTable.h"
+#include <algorithm>
+#include <iterator>
+
+using namespace Gst;
+using Glib::RefPtr;
+
+static const char* table_key = "gst-creator-future-connections";
+
+void FutureConnectionTable::destroy(gpointer table)
+{
+	delete static_cast<FutureConnectionTable*>(table);
+}
+
+FutureConnectionTable& FutureConnectionTable::get(const RefPtr<Gst::Object>& object)
+{
+	static std::mutex creation_mutex;
+
+	GstObject* top = GST_OBJECT(gst_object_ref(object->gobj()));
+	while (GstObject* parent = gst_object_get_parent(top))
+	{
+		gst_object_unref(top);
+		top = parent;
+	}
+
+	std::lock_guard<std::mutex> lock(creation_mutex);
+	FutureConnectionTable* table = static_cast<FutureConnectionTable*>(g_object_get_data(G_OBJECT(top), table_key));
+
+	if (table == nullptr)
+	{
+		table = new FutureConnectionTable();
+		g_object_set_data_full(G_OBJECT(top), table_key, table, &FutureConnectionTable::destroy);
+	}
+
+	gst_object_unref(top);
+
+	return *table;
+}
+
+void FutureConnectionTable::add(const pad_connection& connection)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto& connections = pad_connections[template_key(connection.first.first->gobj(), connection.first.second->get_name())];
+
+	if (std::find(connections.begin(), connections.end(), connection) == connections.end())
+		connections.push_back(connection);
+}
+
+void FutureConnectionTable::add(const element_connection& connection)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto& connections = element_connections[connection.first->gobj()];
+
+	if (std::find(connections.begin(), connections.end(), connection) == connections.end())
+		connections.push_back(connection);
+}
+
+bool FutureConnectionTable::remove(const pad_connection& connection)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = pad_connections.find(template_key(connection.first.first->gobj(), connection.first.second->get_name()));
+
+	if (it == pad_connections.end())
+		return false;
+
+	auto position = std::find(it->second.begin(), it->second.end(), connection);
+
+	if (position == it->second.end())
+		return false;
+
+	it->second.erase(position);
+	if (it->second.empty())
+		pad_connections.erase(it);
+
+	return true;
+}
+
+bool FutureConnectionTable::remove(const element_connection& connection)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = element_connections.find(connection.first->gobj());
+
+	if (it == element_connections.end())
+		return false;
+
+	auto position = std::find(it->second.begin(), it->second.end(), connection);
+
+	if (position == it->second.end())
+		return false;
+
+	it->second.erase(position);
+	if (it->second.empty())
+		element_connections.erase(it);
+
+	return true;
+}
+
+void FutureConnectionTable::clear()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	pad_connections.clear();
+	element_connections.clear();
+}
+
+bool FutureConnectionTable::is_part_of(const RefPtr<Gst::Object>& object, GstObject* removed)
+{
+	GstObject* current = GST_OBJECT(gst_object_ref(object->gobj()));
+
+	while (current && current != removed)
+	{
+		GstObject* parent = gst_object_get_parent(current);
+		gst_object_unref(current);
+		current = parent;
+	}
+
+	if (current)
+		gst_object_unref(current);
+
+	return current != nullptr;
+}
+
+// drops the connections of an object which is removed from the pipeline, including its children and pads
+void FutureConnectionTable::remove_object(const RefPtr<Gst::Object>& object, std::vector<pad_connection>& removed_pads,
+		std::vector<element_connection>& removed_elements)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	for (auto it = pad_connections.begin(); it != pad_connections.end();)
+	{
+		auto& connections = it->second;
+		auto position = std::partition(connections.begin(), connections.end(), [&object](const pad_connection& connection) {
+			return !is_part_of(connection.first.first, object->gobj()) && !is_part_of(connection.second, object->gobj());
+		});
+
+		removed_pads.insert(removed_pads.end(), position, connections.end());
+		connections.erase(position, connections.end());
+		it = connections.empty() ? pad_connections.erase(it) : std::next(it);
+	}
+
+	for (auto it = element_connections.begin(); it != element_connections.end();)
+	{
+		auto& connections = it->second;
+		auto position = std::partition(connections.begin(), connections.end(), [&object](const element_connection& connection) {
+			return !is_part_of(connection.first, object->gobj()) && !is_part_of(connection.second, object->gobj());
+		});
+
+		removed_elements.insert(removed_elements.end(), position, connections.end());
+		connections.erase(position, connections.end());
+		it = connections.empty() ? element_connections.erase(it) : std::next(it);
+	}
+}
+
+std::vector<RefPtr<Pad>> FutureConnectionTable::find_sink_pads(const RefPtr<Element>& parent, const std::string& template_name) const
+{
+	std::vector<RefPtr<Pad>> pads;
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = pad_connections.find(template_key(parent->gobj(), template_name));
+
+	if (it != pad_connections.end())
+		for (auto& connection : it->second)
+			pads.push_back(connection.second);
+
+	return pads;
+}
+
+std::vector<RefPtr<Element>> FutureConnectionTable::find_sink_elements(const RefPtr<Element>& src) const
+{
+	std::vector<RefPtr<Element>> elements;
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = element_connections.find(src->gobj());
+
+	if (it != element_connections.end())
+		for (auto& connection : it->second)
+			elements.push_back(connection.second);
+
+	return elements;
+}
+
+std::vector<FutureConnectionTable::pad_connection> FutureConnectionTable::get_pad_connections() const
+{
+	std::vector<pad_connection> connections;
+	std::lock_guard<std::mutex> lock(mutex);
+
+	for (auto& entry : pad_connections)
+		connections.insert(connections.end(), entry.second.begin(), entry.second.end());
+
+	return connections;
+}
+
+std::vector<FutureConnectionTable::element_connection> FutureConnectionTable::get_element_connections() const
+{
+	std::vector<element_connection> connections;
+	std::lock_guard<std::mutex> lock(mutex);
+
+	for (auto& entry : element_connections)
+		connections.insert(connections.end(), entry.second.begin(), entry.second.end());
+
+	return connections;
+}
@@ -0,0 +1,411 @@
+/*
+ * GraphLayout.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "GraphLayout.h"
+#include <algorithm>
+#include <limits>
+
+constexpr double GraphLayout::layer_spacing;
+constexpr double GraphLayout::node_spacing;
+constexpr int GraphLayout::sweep_count;
+
+typedef std::vector<std::vector<size_t>> adjacency_list;
+
+static size_t count_crossings(const std::vector<size_t>& upper, size_t lower_size,
+		const adjacency_list& down, const std::vector<size_t>& pos)
+{
+	std::vector<std::pair<size_t, size_t>> edges;
+
+	for (auto v : upper)
+		for (auto w : down[v])
+			edges.push_back(std::make_pair(pos[v], pos[w]));
+
+	std::sort(edges.begin(), edges.end());
+
+	// counts inversions of the lower endpoints with a Fenwick tree
+	std::vector<size_t> tree(lower_size + 1, 0);
+	size_t crossings = 0;
+
+	for (size_t i = 0; i < edges.size(); i++)
+	{
+		size_t not_greater = 0;
+		for (size_t j = edges[i].second + 1; j > 0; j -= j & -j)
+			not_greater += tree[j];
+
+		crossings += i - not_greater;
+
+		for (size_t j = edges[i].second + 1; j <= lower_size; j += j & -j)
+			tree[j]++;
+	}
+
+	return crossings;
+}
+
+static size_t count_crossings(const std::vector<std::vector<size_t>>& layers,
+		const adjacency_list& down, const std::vector<size_t>& pos)
+{
+	size_t crossings = 0;
+
+	for (size_t l = 0; l + 1 < layers.size(); l++)
+		crossings += count_crossings(layers[l], layers[l + 1].size(), down, pos);
+
+	return crossings;
+}
+
+static void order_by_barycenter(std::vector<size_t>& layer, const adjacency_list& neighbours, std::vector<size_t>& pos)
+{
+	std::vector<std::pair<double, size_t>> keys;
+	keys.reserve(layer.size());
+
+	for (auto v : layer)
+	{
+		double barycenter = pos[v];
+
+		if (!neighbours[v].empty())
+		{
+			double sum = 0;
+			for (auto w : neighbours[v])
+				sum += pos[w];
+			barycenter = sum / neighbours[v].size();
+		}
+
+		keys.push_back(std::make_pair(barycenter, v));
+	}
+
+	std::stable_sort(keys.begin(), keys.end(),
+			[](const std::pair<double, size_t>& a, const std::pair<double, size_t>& b) { return a.first < b.first; });
+
+	for (size_t i = 0; i < keys.size(); i++)
+	{
+		layer[i] = keys[i].second;
+		pos[layer[i]] = i;
+	}
+}
+
+std::vector<std::pair<double, double>> GraphLayout::compute(const Graph& graph)
+{
+	size_t node_count = graph.nodes.size();
+
+	if (node_count == 0)
+		return std::vector<std::pair<double, double>>();
+
+	std::vector<std::pair<size_t, size_t>> edges;
+	for (auto edge : graph.edges)
+		if (edge.first != edge.second && edge.first < node_count && edge.second < node_count)
+			edges.push_back(edge);
+
+	std::sort(edges.begin(), edges.end());
+	edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+	// cycle removal: reverse every edge pointing back into the DFS stack
+	adjacency_list out(node_count);
+	for (size_t i = 0; i < edges.size(); i++)
+		out[edges[i].first].push_back(i);
+
+	std::vector<char> state(node_count, 0);
+	std::vector<std::pair<size_t, size_t>> stack;
+
+	for (size_t root = 0; root < node_count; root++)
+	{
+		if (state[root])
+			continue;
+
+		state[root] = 1;
+		stack.push_back(std::make_pair(root, 0));
+
+		while (!stack.empty())
+		{
+			size_t v = stack.back().first;
+			size_t& next = stack.back().second;
+
+			if (next == out[v].size())
+			{
+				state[v] = 2;
+				stack.pop_back();
+				continue;
+			}
+
+			auto& edge = edges[out[v][next++]];
+
+			if (state[edge.second] == 1)
+				std::swap(edge.first, edge.second);
+			else if (state[edge.second] == 0)
+			{
+				state[edge.second] = 1;
+				stack.push_back(std::make_pair(edge.second, 0));
+			}
+		}
+	}
+
+	std::sort(edges.begin(), edges.end());
+	edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+	// longest-path layering in topological order
+	adjacency_list succ(node_count), pred(node_count);
+	for (auto edge : edges)
+	{
+		succ[edge.first].push_back(edge.second);
+		pred[edge.second].push_back(edge.first);
+	}
+
+	std::vector<size_t> in_degree(node_count), topological;
+	topological.reserve(node_count);
+
+	for (size_t v = 0; v < node_count; v++)
+	{
+		in_degree[v] = pred[v].size();
+		if (in_degree[v] == 0)
+			topological.push_back(v);
+	}
+
+	std::vector<size_t> layer(node_count, 0);
+
+	for (size_t i = 0; i < topological.size(); i++)
+	{
+		size_t v = topological[i];
+		for (auto w : succ[v])
+		{
+			layer[w] = std::max(layer[w], layer[v] + 1);
+			if (--in_degree[w] == 0)
+				topological.push_back(w);
+		}
+	}
+
+	// pull sources next to their first consumer, e.g. a second source of a muxer
+	for (auto it = topological.rbegin(); it != topological.rend(); ++it)
+	{
+		if (!pred[*it].empty() || succ[*it].empty())
+			continue;
+
+		size_t nearest = std::numeric_limits<size_t>::max();
+		for (auto w : succ[*it])
+			nearest = std::min(nearest, layer[w]);
+		layer[*it] = nearest - 1;
+	}
+
+	// split long edges with dummy nodes, so that every edge joins adjacent layers
+	std::vector<size_t> vlayer(layer);
+	adjacency_list up(node_count), down(node_count);
+
+	for (auto edge : edges)
+	{
+		size_t from = edge.first;
+
+		for (size_t l = layer[edge.first] + 1; l < layer[edge.second]; l++)
+		{
+			size_t dummy = vlayer.size();
+			vlayer.push_back(l);
+			up.push_back(std::vector<size_t>(1, from));
+			down.push_back(std::vector<size_t>());
+			down[from].push_back(dummy);
+			from = dummy;
+		}
+
+		down[from].push_back(edge.second);
+		up[edge.second].push_back(from);
+	}
+
+	size_t vnode_count = vlayer.size();
+	size_t layer_count = *std::max_element(vlayer.begin(), vlayer.end()) + 1;
+
+	// initial order: depth-first from sources keeps connected blocks together
+	std::vector<std::vector<size_t>> layers(layer_count);
+	std::vector<char> visited(vnode_count, 0);
+	std::vector<size_t> dfs_stack;
+
+	for (auto root : topological)
+	{
+		if (visited[root])
+			continue;
+
+		dfs_stack.push_back(root);
+		while (!dfs_stack.empty())
+		{
+			size_t v = dfs_stack.back();
+			dfs_stack.pop_back();
+
+			if (visited[v])
+				continue;
+
+			visited[v] = 1;
+			layers[vlayer[v]].push_back(v);
+
+			for (auto it = down[v].rbegin(); it != down[v].rend(); ++it)
+				if (!visited[*it])
+					dfs_stack.push_back(*it);
+		}
+	}
+
+	std::vector<size_t> pos(vnode_count);
+	for (auto& l : layers)
+		for (size_t i = 0; i < l.size(); i++)
+			pos[l[i]] = i;
+
+	// crossing reduction: alternate barycenter sweeps, keep the best ordering
+	std::vector<std::vector<size_t>> best_layers = layers;
+	size_t best_crossings = count_crossings(layers, down, pos);
+
+	for (int sweep = 0; sweep < sweep_count && best_crossings > 0; sweep++)
+	{
+		if (sweep % 2 == 0)
+			for (size_t l = 1; l < layer_count; l++)
+				order_by_barycenter(layers[l], up, pos);
+		else
+			for (size_t l = layer_count - 1; l-- > 0;)
+				order_by_barycenter(layers[l], down, pos);
+
+		size_t crossings = count_crossings(layers, down, pos);
+		if (crossings < best_crossings)
+		{
+			best_crossings = crossings;
+			best_layers = layers;
+		}
+	}
+
+	layers.swap(best_layers);
+
+	// coordinates: columns per layer, nodes aligned with their predecessors where possible
+	auto width = [&graph, node_count](size_t v) { return v < node_count ? graph.nodes[v].width : 0; };
+	auto height = [&graph, node_count](size_t v) { return v < node_count ? graph.nodes[v].height : 0; };
+
+	std::vector<double> x(vnode_count), y(vnode_count);
+	double layer_x = 0;
+
+	for (auto& l : layers)
+	{
+		double max_width = 0;
+		double bottom = -std::numeric_limits<double>::infinity();
+
+		for (auto v : l)
+		{
+			double desired;
+
+			if (up[v].empty())
+				desired = (bottom == -std::numeric_limits<double>::infinity() ? 0 : bottom + node_spacing);
+			else
+			{
+				double center = 0;
+				for (auto w : up[v])
+					center += y[w] + height(w) / 2;
+				desired = center / up[v].size() - height(v) / 2;
+			}
+
+			y[v] = (bottom == -std::numeric_limits<double>::infinity()) ? desired : std::max(desired, bottom + node_spacing);
+			x[v] = layer_x;
+			bottom = y[v] + height(v);
+			max_width = std::max(max_width, width(v));
+		}
+
+		layer_x += max_width + layer_spacing;
+	}
+
+	std::vector<std::pair<double, double>> positions(node_count);
+	for (size_t v = 0; v < node_count; v++)
+		positions[v] = std::make_pair(x[v], y[v]);
+
+	return positions;
+}
+
+GraphLayout::GraphLayout(QObject* parent)
+: QObject(parent),
+  has_pending(false),
+  stopped(false),
+  latest_id(0),
+  pending_id(0),
+  result_id(0)
+{
+	worker = std::thread(&GraphLayout::run, this);
+}
+
+GraphLayout::~GraphLayout()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopped = true;
+		has_pending = false;
+	}
+
+	condition.notify_one();
+	worker.join();
+}
+
+unsigned int GraphLayout::request(Graph graph)
+{
+	unsigned int id = ++latest_id;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		pending = std::move(graph);
+		pending_id = id;
+		has_pending = true;
+	}
+
+	condition.notify_one();
+
+	return id;
+}
+
+void GraphLayout::cancel()
+{
+	++latest_id;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	has_pending = false;
+	pending = Graph();
+}
+
+bool GraphLayout::take_result(unsigned int id, Result& result)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (id != result_id || id != latest_id)
+		return false;
+
+	result = std::move(this->result);
+	this->result = Result();
+
+	return true;
+}
+
+void GraphLayout::run()
+{
+	while (true)
+	{
+		Graph graph;
+		unsigned int id;
+
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [this] { return has_pending || stopped; });
+
+			if (stopped)
+				return;
+
+			graph = std::move(pending);
+			pending = Graph();
+			id = pending_id;
+			has_pending = false;
+		}
+
+		if (id != latest_id)
+			continue;
+
+		Result computed;
+		computed.positions = compute(graph);
+		for (auto node : graph.nodes)
+			computed.keys.push_back(node.key);
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			result = std::move(computed);
+			result_id = id;
+		}
+
+		if (id == latest_id)
+			Q_EMIT layout_finished(id);
+	}
+}
@@ -7,38 +7,37 @@
 
 #include "GstUtils.h"
 #include "StringUtils.h"
+#include "ElementPathIndex.h"
+#include "CapsCompatibilityCache.h"
+#include "LinkMatrix.h"
+#include "RegistrySnapshot.h"
+#include "FutureConnectionTable.h"
 #include <vector>
+#include <cstring>
 
 using namespace Gst;
 using Glib::RefPtr;
 
 RefPtr<Gst::Element> GstUtils::find_element(std::string text, const RefPtr<Pipeline>& model)
 {
-	std::vector<std::string> elements = StringUtils::split(text, ":");
-	RefPtr<Bin> current_bin = model;
-
-	for (size_t i = 0; i < elements.size() - 1; i++)
-		current_bin = current_bin.cast_static(model->get_element(elements[i].c_str()));
-
-	return current_bin->get_element(elements.back().c_str());
+	return ElementPathIndex::get(model).find_element(text);
 }
 
 RefPtr<Pad> GstUtils::find_pad(std::string text, const RefPtr<Pipeline>& model)
 {
-	unsigned pos = text.find_last_of(":");
-	RefPtr<Element> element = find_element(text.substr(0, pos), model);
-	std::string pad_name = text.substr(pos + 1);
-
-	return element->get_static_pad(pad_name.c_str());
+	return ElementPathIndex::get(model).find_pad(text);
 }
 
 RefPtr<PadTemplate> GstUtils::find_pad_template(std::string text, const RefPtr<Pipeline>& model)
 {
-	unsigned pos = text.find_last_of(":");
+	size_t pos = text.find_last_of(":");
+
+	if (pos == std::string::npos)
+		return RefPtr<PadTemplate>();
+
 	RefPtr<Element> element = find_element(text.substr(0, pos), model);
-	std::string pad_template_name = text.substr(pos + 1);
 
-	return element->get_pad_template(pad_template_name.c_str());
+	return element ? element->get_pad_template(text.substr(pos + 1)) : RefPtr<PadTemplate>();
 }
 
 bool GstUtils::is_numeric_type(GType type)
@@ -52,21 +51,12 @@ bool GstUtils::is_numeric_type(GType type)
 std::vector<std::string> GstUtils::get_avaliable_elements_string()
 {
 	std::vector<std::string> values;
+	auto snapshot = RegistrySnapshot::get();
 
-	RefPtr<Registry> registry = Registry::get();
-	Glib::ListHandle<RefPtr<Plugin>> plugins = registry->get_plugin_list();
-
-	for (auto plugin : plugins)
+	for (auto& feature : snapshot->get_features())
 	{
-		Glib::ListHandle<RefPtr<PluginFeature>> features = registry->get_feature_list(plugin->get_name());
-
-		for (auto feature : features)
-		{
-			if (!feature)
-				continue;
-
-			values.push_back(feature->get_name());
-		}
+		if (feature.type == RegistrySnapshot::FeatureType::ELEMENT_FACTORY)
+			values.push_back(feature.name);
 	}
 
 	return values;
@@ -214,6 +204,11 @@ bool GstUtils::is_src_element(const RefPtr<Element>& element)
 std::string GstUtils::generate_element_path(RefPtr<Object> obj, const RefPtr<Object>& max_parent)
 {
 	std::string path;
+
+	if (obj && max_parent && GST_IS_PIPELINE(max_parent->gobj()) &&
+			ElementPathIndex::get(RefPtr<Bin>::cast_static(max_parent)).find_path(obj, path))
+		return path;
+
 	bool first = true;
 
 	while (obj && obj != max_parent)
@@ -233,6 +228,8 @@ std::string GstUtils::generate_element_path(RefPtr<Object> obj, const RefPtr<Obj
 
 void GstUtils::clean_model(const RefPtr<Pipeline>& model)
 {
+	FutureConnectionTable::get(model).clear();
+
 	auto iterator = model->iterate_elements();
 	std::vector<RefPtr<Element>> elements;
 
@@ -241,6 +238,55 @@ void GstUtils::clean_model(const RefPtr<Pipeline>& model)
 
 	for (auto element : elements)
 		model->remove(element);
+
+	// projects store only non-default values, so the reused pipeline has to start from the defaults
+	guint property_count;
+	GParamSpec **property_specs = g_object_class_list_properties(
+			G_OBJECT_GET_CLASS(model->gobj()), &property_count);
+
+	for (guint i = 0; i < property_count; i++)
+	{
+		if (!strcmp(property_specs[i]->name, "name") || !is_stored_property(property_specs[i], model))
+			continue;
+
+		GValue value = G_VALUE_INIT;
+		g_value_init(&value, property_specs[i]->value_type);
+		g_param_value_set_default(property_specs[i], &value);
+		g_object_set_property(G_OBJECT(model->gobj()), property_specs[i]->name, &value);
+		g_value_unset(&value);
+	}
+
+	g_free(property_specs);
+}
+
+// only generic bins are stored with their children, other bins create them by themselves
+bool GstUtils::is_container(const RefPtr<Element>& element, const RefPtr<Element>& root)
+{
+	if (element == root)
+		return true;
+
+	if (!GST_IS_BIN(element->gobj()) || !element->get_factory())
+		return false;
+
+	std::string factory = element->get_factory()->get_name();
+
+	return factory == "bin" || factory == "pipeline";
+}
+
+// a project stores only the properties it is able to restore and which differ from their defaults
+bool GstUtils::is_stored_property(GParamSpec* param_spec, const RefPtr<Element>& element)
+{
+	if ((param_spec->flags & (G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY)) != G_PARAM_READWRITE)
+		return false;
+
+	GValue value = G_VALUE_INIT;
+	g_value_init(&value, param_spec->value_type);
+	g_object_get_property(G_OBJECT(element->gobj()), param_spec->name, &value);
+
+	bool is_default = g_param_value_defaults(param_spec, &value);
+	g_value_unset(&value);
+
+	return !is_default;
 }
 
 Linkage GstUtils::find_connection(Glib::RefPtr<Gst::Pad> src_pad, Glib::RefPtr<Gst::Element> destination)
@@ -257,7 +303,7 @@ Linkage GstUtils::find_connection(Glib::RefPtr<Gst::Pad> src_pad, Glib::RefPtr<G
 		if (a.get_direction() == PAD_SRC || a.get_presence() == PAD_ALWAYS)
 			continue;
 		auto dest_tpl = destination->get_pad_template(a.get_name_template());
-		if (src_pad->can_link(Gst::Pad::create(dest_tpl)))
+		if (CapsCompatibilityCache::can_link(src_pad, dest_tpl))
 			return {true, src_pad, dest_tpl, src_pad->get_parent(), destination};
 	}
 
@@ -266,12 +312,44 @@ Linkage GstUtils::find_connection(Glib::RefPtr<Gst::Pad> src_pad, Glib::RefPtr<G
 
 Linkage GstUtils::find_connection(Glib::RefPtr<Gst::Element> source, Glib::RefPtr<Gst::PadTemplate> dst_tpl)
 {
-	return find_connection(source, Pad::create(dst_tpl));
+	auto iterator = source->iterate_src_pads();
+	while (iterator.next())
+	{
+		if (CapsCompatibilityCache::can_link(*iterator, dst_tpl))
+			return {true, *iterator, dst_tpl, source, RefPtr<Object>()};
+	}
+
+	for (auto a : source->get_factory()->get_static_pad_templates())
+	{
+		if (a.get_direction() == PAD_SINK || a.get_presence() == PAD_ALWAYS)
+			continue;
+		auto src_tpl = source->get_pad_template(a.get_name_template());
+		if (CapsCompatibilityCache::can_link(src_tpl, dst_tpl))
+			return {true, src_tpl, dst_tpl, source, RefPtr<Object>()};
+	}
+
+	return {false};
 }
 
 Linkage GstUtils::find_connection(Glib::RefPtr<Gst::PadTemplate> src_tpl, Glib::RefPtr<Gst::Element> destination)
 {
-	return find_connection(Pad::create(src_tpl), destination);
+	auto iterator = destination->iterate_sink_pads();
+	while (iterator.next())
+	{
+		if (CapsCompatibilityCache::can_link(src_tpl, *iterator))
+			return {true, src_tpl, *iterator, RefPtr<Object>(), destination};
+	}
+
+	for (auto a : destination->get_factory()->get_static_pad_templates())
+	{
+		if (a.get_direction() == PAD_SRC || a.get_presence() == PAD_ALWAYS)
+			continue;
+		auto dest_tpl = destination->get_pad_template(a.get_name_template());
+		if (CapsCompatibilityCache::can_link(src_tpl, dest_tpl))
+			return {true, src_tpl, dest_tpl, RefPtr<Object>(), destination};
+	}
+
+	return {false};
 }
 
 Linkage GstUtils::find_connection(Glib::RefPtr<Gst::Element> source, Glib::RefPtr<Gst::Pad> dst_port)
@@ -288,7 +366,7 @@ Linkage GstUtils::find_connection(Glib::RefPtr<Gst::Element> source, Glib::RefPt
 		if (a.get_direction() == PAD_SINK || a.get_presence() == PAD_ALWAYS)
 			continue;
 		auto src_tpl = source->get_pad_template(a.get_name_template());
-		if (Gst::Pad::create(src_tpl)->can_link(dst_port))
+		if (CapsCompatibilityCache::can_link(src_tpl, dst_port))
 			return {true, src_tpl, dst_port, source, dst_port->get_parent()};
 	}
 
@@ -297,6 +375,16 @@ Linkage GstUtils::find_connection(Glib::RefPtr<Gst::Element> source, Glib::RefPt
 
 Linkage GstUtils::find_connection(Glib::RefPtr<Gst::Element> source, Glib::RefPtr<Gst::Element> destination)
 {
+	auto matrix = LinkMatrix::get();
+	if (matrix)
+	{
+		int src_factory = matrix->find_factory(source);
+		int sink_factory = matrix->find_factory(destination);
+
+		if (src_factory >= 0 && sink_factory >= 0 && !matrix->can_link(src_factory, sink_factory))
+			return {false};
+	}
+
 	auto first_iterator = source->iterate_src_pads();
 	while (first_iterator.next())
 	{
@@ -308,25 +396,15 @@ Linkage GstUtils::find_connection(Glib::RefPtr<Gst::Element> source, Glib::RefPt
 
 	for (auto fts : source->get_factory()->get_static_pad_templates())
 	{
-		if (fts.get_presence() == PAD_ALWAYS)
+		if (fts.get_direction() == PAD_SINK || fts.get_presence() == PAD_ALWAYS)
 			continue;
 
-		auto tpl = source->get_pad_template(fts.get_name_template());
-		auto tmp_pad = Gst::Pad::create(tpl);
-		auto second_iterator = destination->iterate_sink_pads();
-		while (second_iterator.next())
-		{
-			if (tmp_pad->can_link(*second_iterator))
-				return {true, tpl, *second_iterator, source, destination};
-		}
+		Linkage lnkg = find_connection(source->get_pad_template(fts.get_name_template()), destination);
 
-		for (auto a : destination->get_factory()->get_static_pad_templates())
+		if (lnkg.exists)
 		{
-			if (a.get_direction() == PAD_SRC || a.get_presence() == PAD_ALWAYS)
-				continue;
-			auto dest_tpl = destination->get_pad_template(a.get_name_template());
-			if (tmp_pad->can_link(Gst::Pad::create(dest_tpl)))
-				return {true, tpl, dest_tpl, source, destination};
+			lnkg.src_parent = source;
+			return lnkg;
 		}
 	}
 
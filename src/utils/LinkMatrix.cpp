@@ -0,0 +1,339 @@
+/*
+ * LinkMatrix.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "LinkMatrix.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+
+using namespace Gst;
+using Glib::RefPtr;
+
+static const char cache_magic[4] = {'G', 'C', 'L', 'M'};
+static const guint32 cache_version = 1;
+
+struct CacheHeader
+{
+	char magic[4];
+	guint32 version;
+	guint64 signature;
+	guint64 factory_count;
+	guint64 src_count;
+	guint64 sink_count;
+};
+
+static void hash_string(guint64& hash, const char* str)
+{
+	// FNV-1a; the terminator is hashed too, so concatenated strings don't collide
+	do
+	{
+		hash ^= static_cast<guchar>(*str);
+		hash *= 1099511628211ULL;
+	} while (*str++);
+}
+
+std::mutex LinkMatrix::instance_mutex;
+std::shared_ptr<const LinkMatrix> LinkMatrix::instance;
+std::future<void> LinkMatrix::builder;
+std::atomic<bool> LinkMatrix::cancelled(false);
+
+bool LinkMatrix::test_bit(const std::vector<guint64>& bits, size_t stride, size_t row, size_t col)
+{
+	return (bits[row * stride + col / 64] >> (col % 64)) & 1;
+}
+
+void LinkMatrix::set_bit(std::vector<guint64>& bits, size_t stride, size_t row, size_t col)
+{
+	bits[row * stride + col / 64] |= 1ULL << (col % 64);
+}
+
+std::string LinkMatrix::get_cache_path()
+{
+	gchar* path = g_build_filename(g_get_user_cache_dir(), "gst-creator", "link-matrix.bin", NULL);
+	std::string ret = path;
+	g_free(path);
+
+	return ret;
+}
+
+void LinkMatrix::enumerate_factories(std::vector<GstCaps*>& src_caps, std::vector<GstCaps*>& sink_caps)
+{
+	GstRegistry* registry = gst_registry_get();
+	signature = 14695981039346656037ULL;
+
+	GList* features = gst_registry_get_feature_list(registry, GST_TYPE_ELEMENT_FACTORY);
+	features = g_list_sort(features, [](gconstpointer a, gconstpointer b) {
+		return g_strcmp0(GST_OBJECT_NAME(a), GST_OBJECT_NAME(b));
+	});
+
+	for (GList* l = features; l != nullptr; l = l->next)
+	{
+		GstElementFactory* factory = GST_ELEMENT_FACTORY(l->data);
+		const gchar* klass = gst_element_factory_get_metadata(factory, GST_ELEMENT_METADATA_KLASS);
+		FactoryInfo info;
+
+		info.name = GST_OBJECT_NAME(factory);
+		info.klass = klass ? klass : "";
+		info.rank = gst_plugin_feature_get_rank(GST_PLUGIN_FEATURE(factory));
+		info.src_begin = src_templates.size();
+		info.sink_begin = sink_templates.size();
+
+		hash_string(signature, info.name.c_str());
+
+		GstPlugin* plugin = gst_plugin_feature_get_plugin(GST_PLUGIN_FEATURE(factory));
+		if (plugin != nullptr)
+		{
+			hash_string(signature, gst_plugin_get_version(plugin));
+			gst_object_unref(plugin);
+		}
+
+		for (const GList* t = gst_element_factory_get_static_pad_templates(factory); t != nullptr; t = t->next)
+		{
+			GstStaticPadTemplate* tpl = static_cast<GstStaticPadTemplate*>(t->data);
+
+			if (tpl->direction == GST_PAD_UNKNOWN)
+				continue;
+
+			GstCaps* caps = gst_static_pad_template_get_caps(tpl);
+			gchar* caps_str = gst_caps_to_string(caps);
+			hash_string(signature, tpl->name_template);
+			hash_string(signature, tpl->direction == GST_PAD_SRC ? "src" : "sink");
+			hash_string(signature, caps_str);
+			g_free(caps_str);
+
+			PadTemplateInfo tpl_info = {tpl->name_template, static_cast<PadPresence>(tpl->presence), factories.size()};
+
+			if (tpl->direction == GST_PAD_SRC)
+			{
+				src_templates.push_back(tpl_info);
+				src_caps.push_back(caps);
+			}
+			else
+			{
+				sink_templates.push_back(tpl_info);
+				sink_caps.push_back(caps);
+			}
+		}
+
+		info.src_end = src_templates.size();
+		info.sink_end = sink_templates.size();
+		factory_indices[info.name] = factories.size();
+		factories.push_back(info);
+	}
+
+	gst_plugin_feature_list_free(features);
+
+	template_stride = (sink_templates.size() + 63) / 64;
+	factory_stride = (factories.size() + 63) / 64;
+	template_links.assign(template_stride * src_templates.size(), 0);
+	factory_links.assign(factory_stride * factories.size(), 0);
+}
+
+void LinkMatrix::compute_links(const std::vector<GstCaps*>& src_caps, const std::vector<GstCaps*>& sink_caps)
+{
+	// every row starts at a word boundary, so workers never write the same word
+	ThreadPool::parallel_for(factories.size(), [&](size_t f) {
+		if (cancelled)
+			return;
+
+		for (size_t i = factories[f].src_begin; i < factories[f].src_end; i++)
+		{
+			for (size_t j = 0; j < sink_templates.size(); j++)
+			{
+				if (gst_caps_can_intersect(src_caps[i], sink_caps[j]))
+				{
+					set_bit(template_links, template_stride, i, j);
+					set_bit(factory_links, factory_stride, f, sink_templates[j].factory);
+				}
+			}
+		}
+	});
+}
+
+void LinkMatrix::compute_summary()
+{
+	downstream.assign(factories.size(), false);
+	upstream.assign(factories.size(), false);
+
+	for (size_t f = 0; f < factories.size(); f++)
+	{
+		for (size_t g = 0; g < factories.size(); g++)
+		{
+			if (test_bit(factory_links, factory_stride, f, g))
+			{
+				downstream[f] = true;
+				upstream[g] = true;
+			}
+		}
+	}
+}
+
+bool LinkMatrix::load(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	CacheHeader header;
+
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+		return false;
+
+	if (memcmp(header.magic, cache_magic, sizeof(cache_magic)) != 0 ||
+			header.version != cache_version ||
+			header.signature != signature ||
+			header.factory_count != factories.size() ||
+			header.src_count != src_templates.size() ||
+			header.sink_count != sink_templates.size())
+		return false;
+
+	file.read(reinterpret_cast<char*>(template_links.data()), template_links.size() * sizeof(guint64));
+	file.read(reinterpret_cast<char*>(factory_links.data()), factory_links.size() * sizeof(guint64));
+
+	if (file)
+		return true;
+
+	std::fill(template_links.begin(), template_links.end(), 0);
+	std::fill(factory_links.begin(), factory_links.end(), 0);
+
+	return false;
+}
+
+void LinkMatrix::save(const std::string& path) const
+{
+	gchar* dir = g_path_get_dirname(path.c_str());
+	g_mkdir_with_parents(dir, 0755);
+	g_free(dir);
+
+	CacheHeader header;
+	memcpy(header.magic, cache_magic, sizeof(cache_magic));
+	header.version = cache_version;
+	header.signature = signature;
+	header.factory_count = factories.size();
+	header.src_count = src_templates.size();
+	header.sink_count = sink_templates.size();
+
+	std::string tmp_path = path + ".tmp";
+	std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(template_links.data()), template_links.size() * sizeof(guint64));
+	file.write(reinterpret_cast<const char*>(factory_links.data()), factory_links.size() * sizeof(guint64));
+	file.close();
+
+	if (file)
+		std::rename(tmp_path.c_str(), path.c_str());
+	else
+		std::remove(tmp_path.c_str());
+}
+
+std::shared_ptr<const LinkMatrix> LinkMatrix::build()
+{
+	std::shared_ptr<LinkMatrix> matrix(new LinkMatrix());
+	std::vector<GstCaps*> src_caps, sink_caps;
+	std::string path = get_cache_path();
+
+	matrix->enumerate_factories(src_caps, sink_caps);
+
+	if (!matrix->load(path))
+	{
+		matrix->compute_links(src_caps, sink_caps);
+		if (!cancelled)
+			matrix->save(path);
+	}
+
+	for (auto caps : src_caps)
+		gst_caps_unref(caps);
+	for (auto caps : sink_caps)
+		gst_caps_unref(caps);
+
+	if (cancelled)
+		return nullptr;
+
+	matrix->compute_summary();
+
+	return matrix;
+}
+
+void LinkMatrix::build_async()
+{
+	std::lock_guard<std::mutex> lock(instance_mutex);
+
+	if (builder.valid() && builder.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		return;
+
+	cancelled = false;
+	builder = std::async(std::launch::async, [] {
+		std::shared_ptr<const LinkMatrix> matrix = build();
+		std::lock_guard<std::mutex> lock(instance_mutex);
+		if (matrix)
+			instance = matrix;
+	});
+}
+
+void LinkMatrix::stop()
+{
+	std::future<void> running;
+
+	{
+		std::lock_guard<std::mutex> lock(instance_mutex);
+		running = std::move(builder);
+	}
+
+	// the builder takes the mutex when it finishes, so it can't be held while waiting
+	cancelled = true;
+	if (running.valid())
+		running.wait();
+}
+
+std::shared_ptr<const LinkMatrix> LinkMatrix::get()
+{
+	std::lock_guard<std::mutex> lock(instance_mutex);
+
+	return instance;
+}
+
+int LinkMatrix::find_factory(const std::string& name) const
+{
+	auto it = factory_indices.find(name);
+
+	return (it == factory_indices.end()) ? -1 : it->second;
+}
+
+int LinkMatrix::find_factory(const RefPtr<Element>& element) const
+{
+	// bins expose ghost pads of their children, so templates say nothing about them
+	if (!element || GST_IS_BIN(element->gobj()))
+		return -1;
+
+	GstElementFactory* factory = gst_element_get_factory(element->gobj());
+
+	return factory ? find_factory(GST_OBJECT_NAME(factory)) : -1;
+}
+
+bool LinkMatrix::can_link(size_t src_factory, size_t sink_factory) const
+{
+	return test_bit(factory_links, factory_stride, src_factory, sink_factory);
+}
+
+bool LinkMatrix::can_link_templates(size_t src_tpl, size_t sink_tpl) const
+{
+	return test_bit(template_links, template_stride, src_tpl, sink_tpl);
+}
+
+std::vector<std::pair<std::string, std::string>> LinkMatrix::get_links(size_t src_factory, size_t sink_factory) const
+{
+	std::vector<std::pair<std::string, std::string>> links;
+	const FactoryInfo& src = factories[src_factory];
+	const FactoryInfo& sink = factories[sink_factory];
+
+	for (size_t i = src.src_begin; i < src.src_end; i++)
+		for (size_t j = sink.sink_begin; j < sink.sink_end; j++)
+			if (can_link_templates(i, j))
+				links.push_back(std::make_pair(src_templates[i].name, sink_templates[j].name));
+
+	return links;
+}
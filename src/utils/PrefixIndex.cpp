@@ -0,0 +1,27 @@
+/*
+ * PrefixIndex.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "PrefixIndex.h"
+#include <algorithm>
+
+PrefixIndex::PrefixIndex(std::vector<std::string> values)
+: values(std::move(values))
+{
+	std::sort(this->values.begin(), this->values.end());
+	this->values.erase(std::unique(this->values.begin(), this->values.end()), this->values.end());
+}
+
+std::vector<std::string> PrefixIndex::find(const std::string& prefix) const
+{
+	auto begin = std::lower_bound(values.begin(), values.end(), prefix);
+	auto end = begin;
+
+	while (end != values.end() && end->compare(0, prefix.size(), prefix) == 0)
+		++end;
+
+	return std::vector<std::string>(begin, end);
+}
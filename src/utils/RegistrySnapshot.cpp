@@ -0,0 +1,82 @@
+/*
+ * RegistrySnapshot.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "RegistrySnapshot.h"
+#include <unordered_map>
+
+std::mutex RegistrySnapshot::instance_mutex;
+std::shared_ptr<const RegistrySnapshot> RegistrySnapshot::instance;
+
+RegistrySnapshot::RegistrySnapshot()
+{
+	GstRegistry* registry = gst_registry_get();
+	cookie = gst_registry_get_feature_list_cookie(registry);
+
+	GList* plugin_list = gst_registry_get_plugin_list(registry);
+	std::unordered_map<std::string, size_t> plugin_indices;
+
+	for (GList* l = plugin_list; l != nullptr; l = l->next)
+	{
+		GstPlugin* plugin = GST_PLUGIN(l->data);
+		const gchar* desc = gst_plugin_get_description(plugin);
+
+		plugin_indices[gst_plugin_get_name(plugin)] = plugins.size();
+		plugins.push_back({gst_plugin_get_name(plugin), desc ? desc : "", 0, 0,
+			GST_OBJECT_FLAG_IS_SET(plugin, GST_PLUGIN_FLAG_BLACKLISTED) != FALSE});
+	}
+
+	gst_plugin_list_free(plugin_list);
+
+	// one registry walk for all features; they are grouped by plugin afterwards
+	GList* feature_list = gst_registry_get_feature_list(registry, GST_TYPE_PLUGIN_FEATURE);
+	std::vector<std::vector<FeatureInfo>> plugin_features(plugins.size());
+
+	for (GList* l = feature_list; l != nullptr; l = l->next)
+	{
+		GstPluginFeature* feature = GST_PLUGIN_FEATURE(l->data);
+		const gchar* plugin_name = gst_plugin_feature_get_plugin_name(feature);
+		auto it = plugin_indices.find(plugin_name ? plugin_name : "");
+
+		if (it == plugin_indices.end())
+			continue;
+
+		FeatureInfo info;
+		info.name = GST_OBJECT_NAME(feature);
+		info.plugin = it->second;
+		info.rank = gst_plugin_feature_get_rank(feature);
+
+		if (GST_IS_ELEMENT_FACTORY(feature))
+		{
+			const gchar* klass = gst_element_factory_get_metadata(GST_ELEMENT_FACTORY(feature), GST_ELEMENT_METADATA_KLASS);
+			info.type = FeatureType::ELEMENT_FACTORY;
+			info.klass = klass ? klass : "";
+		}
+		else
+			info.type = GST_IS_TYPE_FIND_FACTORY(feature) ? FeatureType::TYPEFIND_FACTORY : FeatureType::OTHER;
+
+		plugin_features[it->second].push_back(info);
+	}
+
+	gst_plugin_feature_list_free(feature_list);
+
+	for (size_t i = 0; i < plugins.size(); i++)
+	{
+		plugins[i].feature_begin = features.size();
+		features.insert(features.end(), plugin_features[i].begin(), plugin_features[i].end());
+		plugins[i].feature_end = features.size();
+	}
+}
+
+std::shared_ptr<const RegistrySnapshot> RegistrySnapshot::get()
+{
+	std::lock_guard<std::mutex> lock(instance_mutex);
+
+	if (!instance || instance->cookie != gst_registry_get_feature_list_cookie(gst_registry_get()))
+		instance.reset(new RegistrySnapshot());
+
+	return instance;
+}
@@ -0,0 +1,66 @@
+/*
+ * ThreadPool.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include "ThreadPool.h"
+#include <algorithm>
+#include <exception>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <mutex>
+
+unsigned int ThreadPool::get_default_thread_count()
+{
+	return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void ThreadPool::parallel_for(size_t count, const std::function<void(size_t)>& func, unsigned int thread_count)
+{
+	if (count == 0)
+		return;
+
+	if (thread_count == 0)
+		thread_count = get_default_thread_count();
+
+	thread_count = std::min<size_t>(thread_count, count);
+
+	std::atomic<size_t> next(0);
+	std::exception_ptr error;
+	std::mutex error_mutex;
+
+	auto worker = [&] {
+		size_t i;
+
+		while ((i = next++) < count)
+		{
+			try
+			{
+				func(i);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(error_mutex);
+				if (!error)
+					error = std::current_exception();
+				next = count;
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+
+	for (unsigned int t = 1; t < thread_count; t++)
+		workers.push_back(std::thread(worker));
+
+	worker();
+
+	for (auto& t : workers)
+		t.join();
+
+	if (error)
+		std::rethrow_exception(error);
+}
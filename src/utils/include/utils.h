@@ -11,5 +11,14 @@
 #include "utils/StringUtils.h"
 #include "utils/GstUtils.h"
 #include "utils/EnumUtils.h"
+#include "utils/ElementPathIndex.h"
+#include "utils/CapsCompatibilityCache.h"
+#include "utils/ThreadPool.h"
+#include "utils/LinkMatrix.h"
+#include "utils/AutoPlugPathFinder.h"
+#include "utils/PrefixIndex.h"
+#include "utils/RegistrySnapshot.h"
+#include "utils/FutureConnectionTable.h"
+#include "utils/GraphLayout.h"
 
 #endif /* UTILS_H_ */
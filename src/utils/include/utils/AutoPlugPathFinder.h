@@ -0,0 +1,56 @@
+/*
+ * AutoPlugPathFinder.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef AUTOPLUGPATHFINDER_H_
+#define AUTOPLUGPATHFINDER_H_
+
+#include "LinkMatrix.h"
+#include <gstreamermm.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * Looks for the cheapest chain of converters, parsers, decoders and encoders
+ * which can be put between two pads that cannot be linked directly.
+ * Candidates are single input / single output factories taken from the link matrix;
+ * the cost of a factory depends on its class and rank.
+ */
+class AutoPlugPathFinder
+{
+private:
+	struct Node
+	{
+		size_t factory;
+		size_t sink_tpl;
+		size_t src_tpl;
+		double cost;
+	};
+
+	std::shared_ptr<const LinkMatrix> matrix;
+	std::vector<Node> nodes;
+	size_t max_depth;
+	std::chrono::milliseconds time_budget;
+
+	static double get_cost(const LinkMatrix::FactoryInfo& factory);
+	std::vector<size_t> get_templates(const Glib::RefPtr<Gst::Element>& element,
+			const Glib::RefPtr<Gst::Object>& port, Gst::PadDirection direction) const;
+
+public:
+	AutoPlugPathFinder(const std::shared_ptr<const LinkMatrix>& matrix, size_t max_depth = 4,
+			std::chrono::milliseconds time_budget = std::chrono::milliseconds(100));
+
+	bool find_path(const std::vector<size_t>& src_templates, const std::vector<size_t>& sink_templates,
+			std::vector<size_t>& path) const;
+	// port can be a pad, a pad template or null (any pad of the element)
+	bool find_path(const Glib::RefPtr<Gst::Element>& source, const Glib::RefPtr<Gst::Object>& src_port,
+			const Glib::RefPtr<Gst::Element>& destination, const Glib::RefPtr<Gst::Object>& sink_port,
+			std::vector<std::string>& path) const;
+};
+
+#endif /* AUTOPLUGPATHFINDER_H_ */
@@ -0,0 +1,53 @@
+/*
+ * CapsCompatibilityCache.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef CAPSCOMPATIBILITYCACHE_H_
+#define CAPSCOMPATIBILITYCACHE_H_
+
+#include <gstreamermm.h>
+#include <unordered_map>
+#include <utility>
+#include <mutex>
+
+/*
+ * Pad templates used by the editor are element class templates, so a template
+ * identifies a (factory, template name, direction) triple. Template-template
+ * results are memoized; pads are always checked against their current caps,
+ * but never require creating a temporary pad. Everything is dropped
+ * when the registry changes.
+ */
+class CapsCompatibilityCache
+{
+private:
+	typedef std::pair<GstPadTemplate*, GstPadTemplate*> template_pair;
+
+	struct template_pair_hash
+	{
+		size_t operator()(const template_pair& p) const
+		{
+			return std::hash<void*>()(p.first) * 31 + std::hash<void*>()(p.second);
+		}
+	};
+
+	static std::mutex mutex;
+	static guint32 registry_cookie;
+	static std::unordered_map<template_pair, bool, template_pair_hash> results;
+	static std::unordered_map<GstPadTemplate*, Glib::RefPtr<Gst::Pad>> template_pads;
+
+	static void check_registry();
+	static Glib::RefPtr<Gst::Pad> get_template_pad_unlocked(const Glib::RefPtr<Gst::PadTemplate>& tpl);
+
+public:
+	static bool can_link(const Glib::RefPtr<Gst::PadTemplate>& src_tpl, const Glib::RefPtr<Gst::PadTemplate>& sink_tpl);
+	static bool can_link(const Glib::RefPtr<Gst::Pad>& src_pad, const Glib::RefPtr<Gst::PadTemplate>& sink_tpl);
+	static bool can_link(const Glib::RefPtr<Gst::PadTemplate>& src_tpl, const Glib::RefPtr<Gst::Pad>& sink_pad);
+
+	static Glib::RefPtr<Gst::Pad> get_template_pad(const Glib::RefPtr<Gst::PadTemplate>& tpl);
+	static void invalidate();
+};
+
+#endif /* CAPSCOMPATIBILITYCACHE_H_ */
@@ -0,0 +1,63 @@
+/*
+ * ElementPathIndex.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef ELEMENTPATHINDEX_H_
+#define ELEMENTPATHINDEX_H_
+
+#include <gstreamermm.h>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <mutex>
+
+/*
+ * Bidirectional path <-> object index of every element and pad
+ * placed in the root bin (paths are relative to the root, e.g. `bin0:queue0:src`).
+ * A bin's pad and its child element may have the same path, so elements and pads
+ * are indexed separately.
+ * The index is attached to the root bin and kept up to date from
+ * element-added/removed and pad-added/removed signals.
+ */
+class ElementPathIndex
+{
+private:
+	GstBin* root;
+	std::unordered_map<std::string, GstObject*> element_objects;
+	std::unordered_map<std::string, GstObject*> pad_objects;
+	std::unordered_map<GstObject*, std::string> paths;
+	std::unordered_map<GstObject*, std::vector<sigc::connection>> watches;
+	unsigned long revision;
+	mutable std::mutex mutex;
+
+	explicit ElementPathIndex(GstBin* root);
+
+	std::string child_path(GstObject* parent, const Glib::ustring& name) const;
+	void add_object(GstObject* object, const std::string& path);
+	void remove_object(GstObject* object);
+
+	void add_element(const Glib::RefPtr<Gst::Element>& element);
+	void remove_element(const Glib::RefPtr<Gst::Element>& element);
+	void add_pad(const Glib::RefPtr<Gst::Pad>& pad);
+	void remove_pad(const Glib::RefPtr<Gst::Pad>& pad);
+	void watch_bin(const Glib::RefPtr<Gst::Bin>& bin);
+	void watch_element(const Glib::RefPtr<Gst::Element>& element);
+
+	static void destroy(gpointer index);
+
+public:
+	virtual ~ElementPathIndex();
+
+	static ElementPathIndex& get(const Glib::RefPtr<Gst::Bin>& root);
+
+	Glib::RefPtr<Gst::Element> find_element(const std::string& path) const;
+	Glib::RefPtr<Gst::Pad> find_pad(const std::string& path) const;
+	bool find_path(const Glib::RefPtr<Gst::Object>& object, std::string& path) const;
+	// changes each time an object is added to or removed from the index
+	unsigned long get_revision() const;
+};
+
+#endif /* ELEMENTPATHINDEX_H_ */
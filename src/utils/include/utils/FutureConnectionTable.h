@@ -0,0 +1,66 @@
+/*
+ * FutureConnectionTable.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef FUTURECONNECTIONTABLE_H_
+#define FUTURECONNECTIONTABLE_H_
+
+#include <gstreamermm.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*
+ * Connections which are made when a pad appears on an element, indexed by the
+ * element and pad template name. Each pipeline owns its table; lookups are
+ * made by streaming threads, so all the methods are thread-safe.
+ */
+class FutureConnectionTable
+{
+public:
+	typedef std::pair<Glib::RefPtr<Gst::Element>, Glib::RefPtr<Gst::PadTemplate>> template_parent;
+	typedef std::pair<template_parent, Glib::RefPtr<Gst::Pad>> pad_connection;
+	typedef std::pair<Glib::RefPtr<Gst::Element>, Glib::RefPtr<Gst::Element>> element_connection;
+
+private:
+	typedef std::pair<GstElement*, std::string> template_key;
+
+	struct template_key_hash
+	{
+		size_t operator()(const template_key& key) const
+		{
+			return std::hash<void*>()(key.first) * 31 + std::hash<std::string>()(key.second);
+		}
+	};
+
+	mutable std::mutex mutex;
+	std::unordered_map<template_key, std::vector<pad_connection>, template_key_hash> pad_connections;
+	std::unordered_map<GstElement*, std::vector<element_connection>> element_connections;
+
+	static void destroy(gpointer table);
+	static bool is_part_of(const Glib::RefPtr<Gst::Object>& object, GstObject* removed);
+
+public:
+	static FutureConnectionTable& get(const Glib::RefPtr<Gst::Object>& object);
+
+	void add(const pad_connection& connection);
+	void add(const element_connection& connection);
+	bool remove(const pad_connection& connection);
+	bool remove(const element_connection& connection);
+	void clear();
+	void remove_object(const Glib::RefPtr<Gst::Object>& object, std::vector<pad_connection>& removed_pads,
+			std::vector<element_connection>& removed_elements);
+
+	std::vector<Glib::RefPtr<Gst::Pad>> find_sink_pads(const Glib::RefPtr<Gst::Element>& parent, const std::string& template_name) const;
+	std::vector<Glib::RefPtr<Gst::Element>> find_sink_elements(const Glib::RefPtr<Gst::Element>& src) const;
+
+	std::vector<pad_connection> get_pad_connections() const;
+	std::vector<element_connection> get_element_connections() const;
+};
+
+#endif /* FUTURECONNECTIONTABLE_H_ */
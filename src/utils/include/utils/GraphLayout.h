@@ -0,0 +1,77 @@
+/*
+ * GraphLayout.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef GRAPHLAYOUT_H_
+#define GRAPHLAYOUT_H_
+
+#include <QObject>
+#include <condition_variable>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <utility>
+
+/*
+ * Layered (Sugiyama-style) layout of a directed graph, flowing from left to right.
+ * Layout requests are computed on a worker thread; only the latest one is delivered.
+ */
+class GraphLayout : public QObject
+{
+	Q_OBJECT
+public:
+	struct Node
+	{
+		void* key;
+		double width, height;
+	};
+
+	struct Graph
+	{
+		std::vector<Node> nodes;
+		std::vector<std::pair<size_t, size_t>> edges;
+	};
+
+	struct Result
+	{
+		std::vector<void*> keys;
+		std::vector<std::pair<double, double>> positions;
+	};
+
+	static constexpr double layer_spacing = 80;
+	static constexpr double node_spacing = 30;
+	static constexpr int sweep_count = 8;
+
+private:
+	std::thread worker;
+	std::mutex mutex;
+	std::condition_variable condition;
+	Graph pending;
+	bool has_pending;
+	bool stopped;
+	std::atomic<unsigned int> latest_id;
+	unsigned int pending_id;
+	Result result;
+	unsigned int result_id;
+
+	void run();
+
+public:
+	explicit GraphLayout(QObject* parent = 0);
+	virtual ~GraphLayout();
+
+	static std::vector<std::pair<double, double>> compute(const Graph& graph);
+
+	unsigned int request(Graph graph);
+	void cancel();
+	bool take_result(unsigned int id, Result& result);
+
+Q_SIGNALS:
+	void layout_finished(unsigned int id);
+};
+
+#endif /* GRAPHLAYOUT_H_ */
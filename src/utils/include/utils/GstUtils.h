@@ -39,6 +39,8 @@ public:
 	static bool is_src_element(const Glib::RefPtr<Gst::Element>& element);
 	static std::string generate_element_path(Glib::RefPtr<Gst::Object> obj, const Glib::RefPtr<Gst::Object>& max_parent = Glib::RefPtr<Gst::Object>());
 	static void clean_model(const Glib::RefPtr<Gst::Pipeline>& model);
+	static bool is_container(const Glib::RefPtr<Gst::Element>& element, const Glib::RefPtr<Gst::Element>& root);
+	static bool is_stored_property(GParamSpec* param_spec, const Glib::RefPtr<Gst::Element>& element);
 	static Linkage find_connection(Glib::RefPtr<Gst::Element> source, Glib::RefPtr<Gst::Element> destination);
 	static Linkage find_connection(Glib::RefPtr<Gst::Element> source, Glib::RefPtr<Gst::Pad> dst_port);
 	static Linkage find_connection(Glib::RefPtr<Gst::Pad> src_pad, Glib::RefPtr<Gst::Element> destination);
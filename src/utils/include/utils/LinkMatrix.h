@@ -0,0 +1,103 @@
+/*
+ * LinkMatrix.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef LINKMATRIX_H_
+#define LINKMATRIX_H_
+
+#include <gstreamermm.h>
+#include <unordered_map>
+#include <future>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+
+/*
+ * Registry-wide table of element factories which can be linked together,
+ * computed by intersecting caps of static pad templates of every factory.
+ * The matrix is built on worker threads and cached in the user's cache directory.
+ * It is an upper bound: when it says that two factories cannot be linked,
+ * no pad created from their templates can be linked either.
+ */
+class LinkMatrix
+{
+public:
+	struct PadTemplateInfo
+	{
+		std::string name;
+		Gst::PadPresence presence;
+		size_t factory;
+	};
+
+	struct FactoryInfo
+	{
+		std::string name;
+		std::string klass;
+		guint rank;
+		size_t src_begin, src_end;
+		size_t sink_begin, sink_end;
+	};
+
+private:
+	static std::mutex instance_mutex;
+	static std::shared_ptr<const LinkMatrix> instance;
+	static std::future<void> builder;
+	static std::atomic<bool> cancelled;
+
+	guint64 signature;
+	std::vector<FactoryInfo> factories;
+	std::vector<PadTemplateInfo> src_templates;
+	std::vector<PadTemplateInfo> sink_templates;
+	std::unordered_map<std::string, size_t> factory_indices;
+
+	size_t template_stride;
+	size_t factory_stride;
+	std::vector<guint64> template_links;
+	std::vector<guint64> factory_links;
+	std::vector<bool> downstream;
+	std::vector<bool> upstream;
+
+	LinkMatrix() {}
+
+	static bool test_bit(const std::vector<guint64>& bits, size_t stride, size_t row, size_t col);
+	static void set_bit(std::vector<guint64>& bits, size_t stride, size_t row, size_t col);
+	static std::string get_cache_path();
+
+	void enumerate_factories(std::vector<GstCaps*>& src_caps, std::vector<GstCaps*>& sink_caps);
+	void compute_links(const std::vector<GstCaps*>& src_caps, const std::vector<GstCaps*>& sink_caps);
+	void compute_summary();
+	bool load(const std::string& path);
+	void save(const std::string& path) const;
+
+	static std::shared_ptr<const LinkMatrix> build();
+
+public:
+	// the application starts the build once; tools which don't need the matrix never pay for it
+	static void build_async();
+	// cancels a running build and waits for it, must be called before the application exits
+	static void stop();
+	// returns null until a build has finished
+	static std::shared_ptr<const LinkMatrix> get();
+
+	int find_factory(const std::string& name) const;
+	int find_factory(const Glib::RefPtr<Gst::Element>& element) const;
+
+	size_t get_factory_count() const { return factories.size(); }
+	const FactoryInfo& get_factory(size_t factory) const { return factories[factory]; }
+	const PadTemplateInfo& get_src_template(size_t tpl) const { return src_templates[tpl]; }
+	const PadTemplateInfo& get_sink_template(size_t tpl) const { return sink_templates[tpl]; }
+
+	bool can_link(size_t src_factory, size_t sink_factory) const;
+	bool can_link_templates(size_t src_tpl, size_t sink_tpl) const;
+	bool has_downstream(size_t factory) const { return downstream[factory]; }
+	bool has_upstream(size_t factory) const { return upstream[factory]; }
+
+	std::vector<std::pair<std::string, std::string>> get_links(size_t src_factory, size_t sink_factory) const;
+};
+
+#endif /* LINKMATRIX_H_ */
@@ -0,0 +1,74 @@
+/*
+ * MpscQueue.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef MPSCQUEUE_H_
+#define MPSCQUEUE_H_
+
+#include <atomic>
+#include <utility>
+
+/*
+ * Lock-free multiple-producer single-consumer queue (intrusive list with a stub node).
+ * push() may be called from any thread, pop() only from the consumer thread.
+ */
+template<typename T>
+class MpscQueue
+{
+private:
+	struct Node
+	{
+		std::atomic<Node*> next;
+		T value;
+
+		Node() : next(nullptr) {}
+		explicit Node(T value) : next(nullptr), value(std::move(value)) {}
+	};
+
+	std::atomic<Node*> head;
+	Node* tail;
+
+public:
+	MpscQueue()
+	{
+		tail = new Node();
+		head.store(tail);
+	}
+
+	~MpscQueue()
+	{
+		T value;
+		while (pop(value));
+		delete tail;
+	}
+
+	MpscQueue(const MpscQueue&) = delete;
+	MpscQueue& operator=(const MpscQueue&) = delete;
+
+	void push(T value)
+	{
+		Node* node = new Node(std::move(value));
+		Node* previous = head.exchange(node, std::memory_order_acq_rel);
+		previous->next.store(node, std::memory_order_release);
+	}
+
+	// returns false if the queue is empty, or a producer hasn't finished its push yet
+	bool pop(T& value)
+	{
+		Node* next = tail->next.load(std::memory_order_acquire);
+
+		if (next == nullptr)
+			return false;
+
+		value = std::move(next->value);
+		delete tail;
+		tail = next;
+
+		return true;
+	}
+};
+
+#endif /* MPSCQUEUE_H_ */
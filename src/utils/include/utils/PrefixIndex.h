@@ -0,0 +1,33 @@
+/*
+ * PrefixIndex.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef PREFIXINDEX_H_
+#define PREFIXINDEX_H_
+
+#include <vector>
+#include <string>
+
+/*
+ * Sorted set of strings with binary-searched prefix lookups. The index is
+ * immutable; it is rebuilt when its set of values changes.
+ */
+class PrefixIndex
+{
+private:
+	std::vector<std::string> values;
+
+public:
+	PrefixIndex() {}
+	explicit PrefixIndex(std::vector<std::string> values);
+
+	void clear() { values.clear(); }
+	size_t size() const { return values.size(); }
+
+	std::vector<std::string> find(const std::string& prefix) const;
+};
+
+#endif /* PREFIXINDEX_H_ */
@@ -0,0 +1,67 @@
+/*
+ * RegistrySnapshot.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef REGISTRYSNAPSHOT_H_
+#define REGISTRYSNAPSHOT_H_
+
+#include <gstreamermm.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+
+/*
+ * Immutable copy of the plugin registry. Features of a plugin are stored
+ * in the range [feature_begin, feature_end) of the feature array.
+ * The snapshot is shared and rebuilt only when the registry changes.
+ */
+class RegistrySnapshot
+{
+public:
+	enum class FeatureType
+	{
+		ELEMENT_FACTORY,
+		TYPEFIND_FACTORY,
+		OTHER
+	};
+
+	struct PluginInfo
+	{
+		std::string name;
+		std::string description;
+		size_t feature_begin, feature_end;
+		bool blacklisted;
+	};
+
+	struct FeatureInfo
+	{
+		std::string name;
+		size_t plugin;
+		FeatureType type;
+		std::string klass;
+		guint rank;
+	};
+
+private:
+	static std::mutex instance_mutex;
+	static std::shared_ptr<const RegistrySnapshot> instance;
+
+	guint32 cookie;
+	std::vector<PluginInfo> plugins;
+	std::vector<FeatureInfo> features;
+
+	RegistrySnapshot();
+
+public:
+	static std::shared_ptr<const RegistrySnapshot> get();
+
+	guint32 get_cookie() const { return cookie; }
+	const std::vector<PluginInfo>& get_plugins() const { return plugins; }
+	const std::vector<FeatureInfo>& get_features() const { return features; }
+};
+
+#endif /* REGISTRYSNAPSHOT_H_ */
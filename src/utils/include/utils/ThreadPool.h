@@ -0,0 +1,24 @@
+/*
+ * ThreadPool.h
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+#include <functional>
+#include <cstddef>
+
+class ThreadPool
+{
+public:
+	static unsigned int get_default_thread_count();
+
+	// runs func(0) ... func(count - 1) on a set of worker threads and waits for all of them;
+	// the first exception thrown by a worker is rethrown in the caller's thread
+	static void parallel_for(size_t count, const std::function<void(size_t)>& func, unsigned int thread_count = 0);
+};
+
+#endif /* THREADPOOL_H_ */
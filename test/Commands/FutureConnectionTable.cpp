@@ -0,0 +1,91 @@
+/*
+ * FutureConnectionTable.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include <gtest/gtest.h>
+#include <gstreamermm.h>
+#include <memory>
+#include "Commands/AddCommand.h"
+#include "Commands/ConnectCommand.h"
+#include "Commands/RemoveCommand.h"
+#include "utils/FutureConnectionTable.h"
+#include "utils/GstUtils.h"
+
+using namespace Gst;
+using Glib::RefPtr;
+
+static RefPtr<Element> add_element(const RefPtr<Pipeline>& pipeline, const std::string& factory, const std::string& name)
+{
+	RefPtr<Element> element = ElementFactory::create_element(factory, name);
+	AddCommand(ObjectType::ELEMENT, pipeline, element).run_command();
+	return element;
+}
+
+TEST(FutureConnectionTable, ConnectionsAreFoundByTemplateName)
+{
+	Gst::init();
+	RefPtr<Pipeline> pipeline = Pipeline::create();
+	RefPtr<Element> tee = add_element(pipeline, "tee", "tee0");
+	RefPtr<Element> sink = add_element(pipeline, "fakesink", "sink0");
+	auto& table = FutureConnectionTable::get(sink);
+	FutureConnectionTable::pad_connection connection(
+			std::make_pair(tee, tee->get_pad_template("src_%u")), sink->get_static_pad("sink"));
+
+	table.add(connection);
+	table.add(connection);
+	ASSERT_EQ(1, table.find_sink_pads(tee, "src_%u").size());
+	ASSERT_EQ(&table, &FutureConnectionTable::get(pipeline));
+
+	ASSERT_TRUE(table.remove(connection));
+	ASSERT_FALSE(table.remove(connection));
+	ASSERT_TRUE(table.get_pad_connections().empty());
+}
+
+TEST(FutureConnectionTable, RemovedElementsDropTheirConnections)
+{
+	Gst::init();
+	RefPtr<Pipeline> pipeline = Pipeline::create();
+	RefPtr<Element> src = add_element(pipeline, "fakesrc", "src0");
+	RefPtr<Element> sink = add_element(pipeline, "fakesink", "sink0");
+	RefPtr<Element> other = add_element(pipeline, "fakesink", "sink1");
+	auto& table = FutureConnectionTable::get(pipeline);
+
+	table.add(FutureConnectionTable::element_connection(src, sink));
+	table.add(FutureConnectionTable::element_connection(src, other));
+
+	RemoveCommand remove(ObjectType::ELEMENT, sink);
+	remove.run_command();
+	ASSERT_EQ(1, table.find_sink_elements(src).size());
+	ASSERT_EQ(other, table.find_sink_elements(src)[0]);
+
+	std::unique_ptr<Command> inverse(remove.get_inverse());
+	inverse->run_command();
+	ASSERT_EQ(2, table.find_sink_elements(src).size());
+
+	GstUtils::clean_model(pipeline);
+	ASSERT_TRUE(table.get_element_connections().empty());
+}
+
+TEST(FutureConnectionTable, ConnectionsAreAddedWhenCommandRuns)
+{
+	Gst::init();
+	RefPtr<Pipeline> pipeline = Pipeline::create();
+	RefPtr<Element> tee = add_element(pipeline, "tee", "tee0");
+	RefPtr<Element> sink = add_element(pipeline, "fakesink", "sink0");
+	auto& table = FutureConnectionTable::get(pipeline);
+
+	ConnectCommand pads(tee->get_pad_template("src_%u"), tee, sink->get_static_pad("sink"));
+	ConnectCommand elements(tee, sink, true);
+	ASSERT_TRUE(table.get_pad_connections().empty());
+	ASSERT_TRUE(table.get_element_connections().empty());
+
+	pads.run_command();
+	elements.run_command();
+	ASSERT_EQ(1, table.get_pad_connections().size());
+	ASSERT_EQ(1, table.get_element_connections().size());
+
+	GstUtils::clean_model(pipeline);
+}
@@ -0,0 +1,114 @@
+/*
+ * UndoStack.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include <gtest/gtest.h>
+#include "Commands/UndoStack.h"
+
+class CounterCommand : public Command
+{
+	int& counter;
+	int delta;
+public:
+	CounterCommand(int& counter, int delta)
+	: Command(CommandType::PROPERTY), counter(counter), delta(delta) {}
+
+	void run_command(std::vector<CommandListener*> listeners = {}) { counter += delta; }
+	Command* get_inverse() { return new CounterCommand(counter, -delta); }
+	size_t get_memory_size() const { return 100; }
+};
+
+static void run(UndoStack& stack, int& counter, int delta)
+{
+	std::shared_ptr<Command> cmd(new CounterCommand(counter, delta));
+	cmd->run_command();
+	stack.push(cmd);
+}
+
+TEST(UndoStack, UndoAndRedoRunInverseCommands)
+{
+	int counter = 0;
+	UndoStack stack;
+	run(stack, counter, 1);
+	run(stack, counter, 10);
+
+	stack.undo();
+	ASSERT_EQ(1, counter);
+	stack.undo();
+	ASSERT_EQ(0, counter);
+	ASSERT_FALSE(stack.can_undo());
+
+	stack.redo();
+	stack.redo();
+	ASSERT_EQ(11, counter);
+	ASSERT_FALSE(stack.can_redo());
+}
+
+TEST(UndoStack, OldestEntriesAreDroppedWhenLimitsAreExceeded)
+{
+	int counter = 0;
+	UndoStack stack(3, 250);
+
+	for (int i = 0; i < 5; i++)
+		run(stack, counter, 1);
+
+	ASSERT_EQ(200, stack.get_memory_size());
+
+	stack.undo();
+	stack.undo();
+	stack.undo();
+	ASSERT_EQ(3, counter);
+}
+
+class GrowingCommand : public CounterCommand
+{
+	int& counter;
+	int delta;
+	size_t size;
+public:
+	GrowingCommand(int& counter, int delta, size_t size)
+	: CounterCommand(counter, delta), counter(counter), delta(delta), size(size) {}
+
+	Command* get_inverse() { return new GrowingCommand(counter, -delta, size * 2); }
+	size_t get_memory_size() const { return size; }
+};
+
+TEST(UndoStack, LimitIsKeptWhenInverseCommandsGrow)
+{
+	int counter = 0;
+	UndoStack stack(10, 250);
+
+	for (int i = 0; i < 2; i++)
+	{
+		std::shared_ptr<Command> cmd(new GrowingCommand(counter, 1, 100));
+		cmd->run_command();
+		stack.push(cmd);
+	}
+
+	stack.undo();
+	ASSERT_EQ(1, counter);
+	ASSERT_EQ(200, stack.get_memory_size());
+	ASSERT_TRUE(stack.can_redo());
+	ASSERT_FALSE(stack.can_undo());
+}
+
+TEST(UndoStack, LoweringLimitKeepsNearestRedoEntries)
+{
+	int counter = 0;
+	UndoStack stack(10, 1000);
+
+	for (int i = 0; i < 3; i++)
+		run(stack, counter, 1);
+	for (int i = 0; i < 3; i++)
+		stack.undo();
+
+	stack.set_memory_limit(150);
+	ASSERT_EQ(100, stack.get_memory_size());
+
+	stack.redo();
+	ASSERT_EQ(1, counter);
+	ASSERT_FALSE(stack.can_redo());
+}
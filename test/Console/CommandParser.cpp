@@ -18,3 +18,14 @@ TEST(CommandParser, DummyTest)
 }
 
 
+
+TEST(CommandParser, BatchCommandIsSplitOnSemicolons)
+{
+	Glib::RefPtr<Gst::Pipeline> pipeline = Gst::Pipeline::create();
+	CommandParser parser(pipeline);
+	std::shared_ptr<Command> cmd(parser.parse("BATCH STATE PLAY ; STATE STOP;"));
+
+	ASSERT_EQ(CommandType::BATCH, cmd->get_type());
+	ASSERT_EQ(2, static_cast<BatchCommand*>(cmd.get())->get_command_count());
+	ASSERT_THROW(parser.parse("BATCH ;"), std::runtime_error);
+}
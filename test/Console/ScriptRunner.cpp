@@ -0,0 +1,38 @@
+/*
+ * ScriptRunner.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include <gtest/gtest.h>
+#include <gstreamermm.h>
+#include <sstream>
+#include "Console/ScriptRunner.h"
+
+TEST(ScriptRunner, CommentsAndEmptyLinesAreSkipped)
+{
+	Glib::RefPtr<Gst::Pipeline> pipeline = Gst::Pipeline::create();
+	ScriptRunner runner(pipeline);
+	std::istringstream script("# comment\n\n\tSTATE STOP\r\n");
+
+	runner.run(script);
+	ASSERT_EQ(1, runner.get_executed_count());
+}
+
+TEST(ScriptRunner, ErrorsReportLineNumber)
+{
+	Glib::RefPtr<Gst::Pipeline> pipeline = Gst::Pipeline::create();
+	ScriptRunner runner(pipeline);
+	std::istringstream script("STATE STOP\n# comment\nUNKNOWN command\n");
+
+	try
+	{
+		runner.run(script);
+		FAIL();
+	}
+	catch (const std::runtime_error& ex)
+	{
+		ASSERT_EQ(0, std::string(ex.what()).find("line 3: "));
+	}
+}
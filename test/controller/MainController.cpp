@@ -0,0 +1,44 @@
+/*
+ * MainController.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include <gtest/gtest.h>
+#include <gstreamermm.h>
+#include <memory>
+#include "Commands/AddCommand.h"
+#include "Commands/ConnectCommand.h"
+#include "Commands/DisconnectCommand.h"
+#include "controller/MainController.h"
+#include "utils/FutureConnectionTable.h"
+
+using namespace Gst;
+using Glib::RefPtr;
+
+TEST(MainController, RecordingFutureDisconnectionKeepsItRemoved)
+{
+	Gst::init();
+	RefPtr<Pipeline> model = Pipeline::create("main-pipeline");
+	MainController controller(model);
+	RefPtr<Element> tee = ElementFactory::create_element("tee", "tee0");
+	RefPtr<Element> sink = ElementFactory::create_element("fakesink", "sink0");
+	AddCommand(ObjectType::ELEMENT, model, tee).run_command();
+	AddCommand(ObjectType::ELEMENT, model, sink).run_command();
+
+	RefPtr<PadTemplate> tpl = tee->get_pad_template("src_%u");
+	ConnectCommand(tpl, tee, sink->get_static_pad("sink")).run_command();
+	ASSERT_EQ(1, FutureConnectionTable::get(model).get_pad_connections().size());
+
+	std::shared_ptr<Command> disconnect(new DisconnectCommand(tpl, sink->get_static_pad("sink")));
+	disconnect->run_command();
+	controller.command_executed(disconnect);
+
+	ASSERT_TRUE(FutureConnectionTable::get(model).get_pad_connections().empty());
+
+	controller.undo({});
+	ASSERT_EQ(1, FutureConnectionTable::get(model).get_pad_connections().size());
+
+	controller.clean_model();
+}
@@ -0,0 +1,101 @@
+/*
+ * ProjectFormats.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include <gtest/gtest.h>
+#include <gstreamermm.h>
+#include <QTemporaryDir>
+#include <set>
+#include "Commands/AddCommand.h"
+#include "Commands/ConnectCommand.h"
+#include "controller/FileWriter.h"
+#include "controller/FileLoader.h"
+#include "controller/BinaryFileWriter.h"
+#include "controller/BinaryFileLoader.h"
+
+using namespace Gst;
+using Glib::RefPtr;
+
+static std::set<std::string> describe(const RefPtr<Pipeline>& model)
+{
+	std::set<std::string> description;
+	auto elements = model->iterate_elements();
+
+	while (elements.next())
+	{
+		int num_buffers = 0;
+		if (g_object_class_find_property(G_OBJECT_GET_CLASS(elements->gobj()), "num-buffers"))
+			g_object_get(elements->gobj(), "num-buffers", &num_buffers, NULL);
+
+		description.insert(elements->get_name() + " num-buffers=" + std::to_string(num_buffers));
+
+		auto pads = elements->iterate_src_pads();
+		while (pads.next())
+			if (pads->get_peer())
+				description.insert(elements->get_name() + " -> " + pads->get_peer()->get_parent_element()->get_name());
+	}
+
+	return description;
+}
+
+static void save(const std::string& filename, const RefPtr<Pipeline>& model)
+{
+	auto finder = [](const RefPtr<Element>&) { return QPointF(); };
+
+	if (BinaryProject::is_binary_file(filename))
+		BinaryFileWriter(filename, model, finder).save_model();
+	else
+		FileWriter(filename, model, finder).save_model();
+}
+
+static RefPtr<Pipeline> load(const std::string& filename)
+{
+	RefPtr<Pipeline> model = Pipeline::create("main-pipeline");
+	auto pos_setter = [](const RefPtr<Element>&, double, double) {};
+
+	if (BinaryProject::is_binary_file(filename))
+		BinaryFileLoader(filename, model, pos_setter).load_model({});
+	else
+		FileLoader(filename, model, pos_setter).load_model({});
+
+	return model;
+}
+
+TEST(ProjectFormats, BinaryAndXmlRoundTripsAreEqual)
+{
+	Gst::init();
+	QTemporaryDir dir;
+	std::string xml = dir.path().toStdString() + "/project.gstc",
+			binary = dir.path().toStdString() + "/project.gstcb";
+
+	RefPtr<Pipeline> model = Pipeline::create("main-pipeline");
+	RefPtr<Element> src = ElementFactory::create_element("fakesrc", "src"),
+			tee = ElementFactory::create_element("tee", "tee"),
+			sink = ElementFactory::create_element("fakesink", "sink");
+
+	for (auto element : {src, tee, sink})
+		AddCommand(ObjectType::ELEMENT, model, element).run_command();
+
+	src->set_property("num-buffers", 5);
+	ConnectCommand(src->get_static_pad("src"), tee->get_static_pad("sink")).run_command();
+
+	// the linked pad is src_1, which is recreated as src_0 when the project is loaded
+	RefPtr<Pad> unused = tee->get_request_pad("src_%u");
+	RefPtr<Pad> linked = tee->get_request_pad("src_%u");
+	tee->release_request_pad(unused);
+	ConnectCommand(linked, sink->get_static_pad("sink")).run_command();
+
+	std::set<std::string> expected = describe(model);
+	ASSERT_EQ(1, expected.count("tee -> sink"));
+
+	save(xml, model);
+	save(binary, load(xml));
+	ASSERT_EQ(expected, describe(load(binary)));
+
+	save(binary, model);
+	save(xml, load(binary));
+	ASSERT_EQ(expected, describe(load(xml)));
+}
@@ -0,0 +1,33 @@
+/*
+ * ElementPathIndex.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include <gtest/gtest.h>
+#include <gstreamermm.h>
+#include "utils/ElementPathIndex.h"
+
+using namespace Gst;
+using Glib::RefPtr;
+
+TEST(ElementPathIndex, PadsAndElementsWithTheSamePathAreBothFound)
+{
+	Gst::init();
+	RefPtr<Pipeline> pipeline = Pipeline::create();
+	RefPtr<Bin> bin = Bin::create("bin0");
+	RefPtr<Element> src = ElementFactory::create_element("fakesrc", "src");
+
+	pipeline->add(bin);
+	bin->add(src);
+	bin->add_pad(GhostPad::create(src->get_static_pad("src"), "src"));
+
+	auto& index = ElementPathIndex::get(pipeline);
+	ASSERT_EQ(src, index.find_element("bin0:src"));
+	ASSERT_TRUE(index.find_pad("bin0:src"));
+
+	bin->remove(src);
+	ASSERT_FALSE(index.find_element("bin0:src"));
+	ASSERT_TRUE(index.find_pad("bin0:src"));
+}
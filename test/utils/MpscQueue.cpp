@@ -0,0 +1,42 @@
+/*
+ * MpscQueue.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include <gtest/gtest.h>
+#include "utils/MpscQueue.h"
+#include <thread>
+#include <vector>
+
+TEST(MpscQueue, KeepsOrderOfEachProducer)
+{
+	const int producer_count = 4, item_count = 10000;
+	MpscQueue<int> queue;
+	std::vector<std::thread> producers;
+
+	for (int p = 0; p < producer_count; p++)
+		producers.emplace_back([&queue, p, item_count] {
+			for (int i = 0; i < item_count; i++)
+				queue.push(p * item_count + i);
+		});
+
+	std::vector<int> last(producer_count, -1);
+	int received = 0, value;
+
+	while (received < producer_count * item_count)
+	{
+		if (!queue.pop(value))
+			continue;
+
+		ASSERT_EQ(last[value / item_count] + 1, value % item_count);
+		last[value / item_count] = value % item_count;
+		received++;
+	}
+
+	for (auto& producer : producers)
+		producer.join();
+
+	ASSERT_FALSE(queue.pop(value));
+}
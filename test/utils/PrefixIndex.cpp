@@ -0,0 +1,29 @@
+/*
+ * PrefixIndex.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: Marcin Kolny
+ */
+
+#include <gtest/gtest.h>
+#include "utils/PrefixIndex.h"
+
+TEST(PrefixIndex, FindsAllValuesWithPrefix)
+{
+	PrefixIndex index({"videotestsrc", "audiotestsrc", "videoconvert", "videoscale", "video"});
+
+	std::vector<std::string> expected = {"video", "videoconvert", "videoscale", "videotestsrc"};
+	ASSERT_EQ(expected, index.find("video"));
+	ASSERT_EQ(std::vector<std::string>{"audiotestsrc"}, index.find("a"));
+	ASSERT_TRUE(index.find("x").empty());
+	ASSERT_EQ(5u, index.find("").size());
+}
+
+TEST(PrefixIndex, DuplicatesAreStoredOnce)
+{
+	PrefixIndex index({"queue2", "queue", "queue"});
+
+	ASSERT_EQ(2u, index.size());
+	std::vector<std::string> expected = {"queue", "queue2"};
+	ASSERT_EQ(expected, index.find("q"));
+}